@@ -0,0 +1,169 @@
+#pragma once
+// Native stand-in for RemoteController.lua, so the control protocol can be exercised without a
+// Roblox client. It speaks the same /poll and /result protocol: one thread long-polls for
+// commands, and a frame thread applies them on frame boundaries and posts the results, like a
+// Heartbeat-driven game loop. Each command lands on the first frame after latency_ms plus up to
+// jitter_ms of uniform noise. Batches resolve in a single frame with one result array.
+// Like the Lua bridge it polls with ?schema=compact and expands the positional commands through
+// protocol::expand, so every run also round-trips ControlServer's to_compact output.
+
+#include "control/protocol.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <httplib.h>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct BridgeSimulatorOptions {
+    int port = 8000;
+    double frame_ms = 1000.0 / 60.0;
+    double latency_ms = 0.0;
+    double jitter_ms = 0.0;
+    // the Lua bridge long-polls with this wait
+    int long_poll_ms = 10000;
+};
+
+class BridgeSimulator {
+  public:
+    explicit BridgeSimulator(const BridgeSimulatorOptions& options) : options(options) {}
+    ~BridgeSimulator() { stop(); }
+
+    BridgeSimulator(const BridgeSimulator&) = delete;
+    BridgeSimulator& operator=(const BridgeSimulator&) = delete;
+
+    void start() {
+        running = true;
+        poll_thread = std::thread([this] { poll_loop(); });
+        frame_thread = std::thread([this] { frame_loop(); });
+    }
+
+    // the server has to be stopped first (or answer the parked /poll) for this to return quickly
+    void stop() {
+        if (!running.exchange(false))
+            return;
+        if (poll_thread.joinable())
+            poll_thread.join();
+        if (frame_thread.joinable())
+            frame_thread.join();
+    }
+
+    uint64_t commands_applied() const { return applied; }
+    uint64_t frames() const { return frame_count; }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Pending {
+        Clock::time_point due;
+        nlohmann::json command;
+    };
+
+    BridgeSimulatorOptions options;
+    std::atomic<bool> running{false};
+    std::atomic<uint64_t> applied{0};
+    std::atomic<uint64_t> frame_count{0};
+
+    std::mutex pending_mutex;
+    std::deque<Pending> pending;
+
+    std::thread poll_thread;
+    std::thread frame_thread;
+
+    static nlohmann::json apply(const nlohmann::json& command) {
+        nlohmann::json data = command.value("data", nlohmann::json::object());
+        if (command.value("action", "") == "batch") {
+            nlohmann::json results = nlohmann::json::array();
+            for (const auto& entry : data.value("commands", nlohmann::json::array())) {
+                results.push_back({{"status", "completed"},
+                                   {"result", entry.value("data", nlohmann::json::object())}});
+            }
+            return {{"results", results}};
+        }
+        return data;
+    }
+
+    void poll_loop() {
+        httplib::Client client("localhost", options.port);
+        client.set_keep_alive(true);
+        client.set_read_timeout(options.long_poll_ms / 1000 + 5);
+
+        std::mt19937 rng(std::random_device{}());
+        std::uniform_real_distribution<double> jitter(0.0, (std::max)(options.jitter_ms, 1.0));
+
+        while (running) {
+            auto res = client.Get("/poll?schema=compact&wait=" +
+                                  std::to_string(options.long_poll_ms));
+            if (!res || res->status != 200) {
+                // same back-off as the Lua loop
+                if (running)
+                    std::this_thread::sleep_for(std::chrono::seconds(1));
+                continue;
+            }
+
+            auto body = nlohmann::json::parse(res->body, nullptr, false);
+            if (!body.is_object() || !body["commands"].is_array())
+                continue;
+
+            auto now = Clock::now();
+            {
+                std::lock_guard<std::mutex> lock(pending_mutex);
+                for (const auto& entry : body["commands"]) {
+                    // an entry that does not decode is dropped, as the Lua bridge does
+                    auto cmd = control::protocol::expand(entry);
+                    if (!cmd)
+                        continue;
+                    double delay_ms =
+                        options.latency_ms + (options.jitter_ms > 0.0 ? jitter(rng) : 0.0);
+                    auto due = now + std::chrono::duration_cast<Clock::duration>(
+                                         std::chrono::duration<double, std::milli>(delay_ms));
+                    pending.push_back({due, std::move(*cmd)});
+                }
+            }
+        }
+    }
+
+    void frame_loop() {
+        httplib::Client client("localhost", options.port);
+        client.set_keep_alive(true);
+
+        auto frame = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double, std::milli>(options.frame_ms));
+        auto next_frame = Clock::now() + frame;
+
+        while (running) {
+            std::this_thread::sleep_until(next_frame);
+            auto now = Clock::now();
+            next_frame += frame;
+            // a stalled host should not make the simulator burst frames to catch up
+            if (next_frame < now)
+                next_frame = now + frame;
+            frame_count++;
+
+            std::vector<nlohmann::json> due;
+            {
+                std::lock_guard<std::mutex> lock(pending_mutex);
+                auto split = std::stable_partition(pending.begin(), pending.end(),
+                                                   [&](const Pending& p) { return p.due <= now; });
+                for (auto it = pending.begin(); it != split; ++it)
+                    due.push_back(std::move(it->command));
+                pending.erase(pending.begin(), split);
+            }
+
+            for (const auto& cmd : due) {
+                nlohmann::json payload = {{"command_id", cmd.at("id")},
+                                          {"status", "completed"},
+                                          {"result", apply(cmd)},
+                                          {"timestamp", ""}};
+                client.Post("/result", payload.dump(), "application/json");
+                applied++;
+            }
+        }
+    }
+};
@@ -0,0 +1,159 @@
+// Round-trip benchmark for the control channel.
+//
+// Starts a ControlServer on a local port and plays both ends against it: an echo bridge that
+// answers every command with its own data, standing in for RemoteController.lua, and a driver
+// that issues commands through /execute and waits on /status the way Controller does. The bridge
+// takes commands from /stream by default, or from /poll with --poll, so both transports can be
+// measured on any host without a Roblox client.
+//
+//   roblox-dumper-echo [--count <n>] [--port <port>] [--poll]
+
+#include "control/control_server.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <httplib.h>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    struct Options {
+        size_t count = 2000;
+        int port = 18000;
+        bool poll = false;
+    };
+
+    void echo(httplib::Client& client, const nlohmann::json& cmd) {
+        nlohmann::json payload = {{"command_id", cmd["id"]},
+                                  {"status", "completed"},
+                                  {"result", cmd["data"]},
+                                  {"timestamp", ""}};
+        client.Post("/result", payload.dump(), "application/json");
+    }
+
+    void run_stream_bridge(int port, const std::atomic<bool>& stop) {
+        httplib::Client results("localhost", port);
+        results.set_keep_alive(true);
+
+        httplib::Client stream("localhost", port);
+        stream.set_read_timeout(control::STREAM_HEARTBEAT_MS / 1000 * 3);
+
+        std::string buffer;
+        stream.Get("/stream", [&](const char* data, size_t length) {
+            buffer.append(data, length);
+            size_t newline;
+            while ((newline = buffer.find('\n')) != std::string::npos) {
+                auto cmd = nlohmann::json::parse(buffer.substr(0, newline), nullptr, false);
+                buffer.erase(0, newline + 1);
+                if (cmd.is_object() && cmd.contains("action"))
+                    echo(results, cmd);
+            }
+            return !stop;
+        });
+    }
+
+    void run_poll_bridge(int port, const std::atomic<bool>& stop) {
+        httplib::Client client("localhost", port);
+        client.set_keep_alive(true);
+
+        while (!stop) {
+            auto res = client.Get("/poll?wait=1000");
+            if (!res || res->status != 200)
+                continue;
+            auto body = nlohmann::json::parse(res->body, nullptr, false);
+            if (!body.is_object())
+                continue;
+            for (const auto& cmd : body["commands"])
+                echo(client, cmd);
+        }
+    }
+
+    double percentile(const std::vector<double>& sorted, double p) {
+        if (sorted.empty())
+            return 0.0;
+        size_t index = std::min(sorted.size() - 1, size_t(p * double(sorted.size())));
+        return sorted[index];
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--count") && i + 1 < argc) {
+            options.count = std::strtoull(argv[++i], nullptr, 10);
+        } else if (!std::strcmp(argv[i], "--port") && i + 1 < argc) {
+            options.port = std::atoi(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--poll")) {
+            options.poll = true;
+        } else {
+            std::fprintf(stderr, "usage: %s [--count <n>] [--port <port>] [--poll]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    control::ControlServer server(options.port);
+    server.start();
+    if (!server.is_running()) {
+        std::fprintf(stderr, "failed to start the control server on port %d\n", options.port);
+        return 1;
+    }
+
+    std::atomic<bool> stop{false};
+    std::thread bridge(options.poll ? run_poll_bridge : run_stream_bridge, options.port,
+                       std::cref(stop));
+
+    httplib::Client driver("localhost", options.port);
+    driver.set_keep_alive(true);
+    driver.set_read_timeout(10);
+
+    std::vector<double> latencies;
+    latencies.reserve(options.count);
+    size_t failures = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < options.count; i++) {
+        auto sent = std::chrono::steady_clock::now();
+
+        nlohmann::json payload = {{"action", "echo"}, {"data", {{"seq", i}}}};
+        auto queued = driver.Post("/execute", payload.dump(), "application/json");
+        if (!queued || queued->status != 200) {
+            failures++;
+            continue;
+        }
+        uint64_t id = nlohmann::json::parse(queued->body)["command_id"];
+
+        auto status = driver.Get("/status/" + std::to_string(id) + "?wait=5000");
+        nlohmann::json body =
+            status ? nlohmann::json::parse(status->body, nullptr, false) : nlohmann::json();
+        if (!body.is_object() || body["status"] != "completed" || body["result"]["seq"] != i) {
+            failures++;
+            continue;
+        }
+
+        latencies.push_back(std::chrono::duration<double, std::milli>(
+                                std::chrono::steady_clock::now() - sent)
+                                .count());
+    }
+    double elapsed_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    stop = true;
+    // ends the stream response and releases a parked /poll
+    server.stop();
+    bridge.join();
+
+    std::sort(latencies.begin(), latencies.end());
+    std::printf("transport:  %s\n", options.poll ? "poll" : "stream");
+    std::printf("commands:   %zu (%zu failed)\n", options.count, failures);
+    std::printf("throughput: %.0f cmds/s\n", double(latencies.size()) / elapsed_s);
+    std::printf("latency:    p50 %.3fms  p99 %.3fms  max %.3fms\n", percentile(latencies, 0.50),
+                percentile(latencies, 0.99), latencies.empty() ? 0.0 : latencies.back());
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,195 @@
+// Load test for the control protocol.
+//
+// Starts a ControlServer and a BridgeSimulator in place of the Roblox client, then drives N
+// concurrent Controllers through them, each sending commands back to back the way a phase does.
+// Frame time, per-command latency and jitter of the simulated game are configurable, so the
+// interactive lane can be tuned without a game. Reports commands/sec and round-trip latency.
+//
+//   roblox-dumper-load [--controllers <n>] [--commands <n>] [--batch <n>] [--port <port>]
+//                      [--frame-ms <ms>] [--latency-ms <ms>] [--jitter-ms <ms>] [--json]
+//                      [--async]
+//
+// --batch sends groups of n commands through Controller::execute_batch; latency is then per
+// batch. With --async the n commands of a group are issued through execute_async and awaited
+// with wait_all instead. --json makes the controllers talk JSON instead of MessagePack.
+
+#include "bridge_simulator.hpp"
+#include "control/control.hpp"
+#include "control/control_server.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    struct Options {
+        size_t controllers = 4;
+        size_t commands = 500;
+        size_t batch = 1;
+        bool async = false;
+        int port = 18001;
+        control::protocol::Encoding encoding = control::protocol::Encoding::MsgPack;
+        BridgeSimulatorOptions bridge;
+    };
+
+    bool parse_args(int argc, char** argv, Options& options) {
+        for (int i = 1; i < argc; i++) {
+            bool has_value = i + 1 < argc;
+            if (!std::strcmp(argv[i], "--controllers") && has_value) {
+                options.controllers = std::strtoull(argv[++i], nullptr, 10);
+            } else if (!std::strcmp(argv[i], "--commands") && has_value) {
+                options.commands = std::strtoull(argv[++i], nullptr, 10);
+            } else if (!std::strcmp(argv[i], "--batch") && has_value) {
+                options.batch = std::strtoull(argv[++i], nullptr, 10);
+            } else if (!std::strcmp(argv[i], "--port") && has_value) {
+                options.port = std::atoi(argv[++i]);
+            } else if (!std::strcmp(argv[i], "--frame-ms") && has_value) {
+                options.bridge.frame_ms = std::atof(argv[++i]);
+            } else if (!std::strcmp(argv[i], "--latency-ms") && has_value) {
+                options.bridge.latency_ms = std::atof(argv[++i]);
+            } else if (!std::strcmp(argv[i], "--jitter-ms") && has_value) {
+                options.bridge.jitter_ms = std::atof(argv[++i]);
+            } else if (!std::strcmp(argv[i], "--json")) {
+                options.encoding = control::protocol::Encoding::Json;
+            } else if (!std::strcmp(argv[i], "--async")) {
+                options.async = true;
+            } else {
+                return false;
+            }
+        }
+        options.bridge.port = options.port;
+        return options.controllers > 0 && options.batch > 0 && options.bridge.frame_ms > 0.0;
+    }
+
+    double percentile(const std::vector<double>& sorted, double p) {
+        if (sorted.empty())
+            return 0.0;
+        size_t index = (std::min)(sorted.size() - 1, size_t(p * double(sorted.size())));
+        return sorted[index];
+    }
+
+    struct Outcome {
+        std::vector<double> latencies;
+        size_t failures = 0;
+        control::Controller::Metrics metrics;
+    };
+
+    Outcome drive(const Options& options, size_t worker) {
+        Outcome outcome;
+        control::Controller controller("http://localhost:" + std::to_string(options.port));
+        controller.set_encoding(options.encoding);
+
+        for (size_t sent = 0; sent < options.commands; sent += options.batch) {
+            auto start = std::chrono::steady_clock::now();
+
+            bool ok;
+            if (options.async) {
+                std::vector<control::AsyncResult> pending;
+                for (size_t i = 0; i < options.batch; i++) {
+                    pending.push_back(controller.execute_async(
+                        "echo", {{"worker", worker}, {"seq", sent + i}}));
+                }
+                ok = control::Controller::wait_all(pending);
+            } else if (options.batch == 1) {
+                std::string id = controller.send_command(
+                    "echo", {{"worker", worker}, {"seq", sent}});
+                auto result = id.empty() ? std::nullopt : controller.wait_for_completion(id);
+                ok = result && result->status == "completed" && result->result["seq"] == sent;
+            } else {
+                std::vector<control::BatchCommand> batch;
+                for (size_t i = 0; i < options.batch; i++)
+                    batch.push_back({"echo", {{"worker", worker}, {"seq", sent + i}}});
+                auto results = controller.execute_batch(batch);
+                ok = results && std::all_of(results->begin(), results->end(), [](const auto& r) {
+                         return r.status == "completed";
+                     });
+            }
+
+            if (!ok) {
+                outcome.failures++;
+                continue;
+            }
+            outcome.latencies.push_back(std::chrono::duration<double, std::milli>(
+                                            std::chrono::steady_clock::now() - start)
+                                            .count());
+        }
+
+        outcome.metrics = controller.metrics();
+        return outcome;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parse_args(argc, argv, options)) {
+        std::fprintf(stderr,
+                     "usage: %s [--controllers <n>] [--commands <n>] [--batch <n>] "
+                     "[--port <port>] [--frame-ms <ms>] [--latency-ms <ms>] [--jitter-ms <ms>] "
+                     "[--json] [--async]\n",
+                     argv[0]);
+        return 1;
+    }
+
+    control::ControlServer server(options.port);
+    server.start();
+    if (!server.is_running()) {
+        std::fprintf(stderr, "failed to start the control server on port %d\n", options.port);
+        return 1;
+    }
+
+    BridgeSimulator bridge(options.bridge);
+    bridge.start();
+
+    // Controller logs every command it sends; that would dominate the run, and the report below
+    // goes through stdio
+    std::cout.setstate(std::ios::failbit);
+
+    std::vector<Outcome> outcomes(options.controllers);
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < options.controllers; i++)
+        workers.emplace_back([&, i] { outcomes[i] = drive(options, i); });
+    for (auto& worker : workers)
+        worker.join();
+    double elapsed_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout.clear();
+    server.stop();
+    bridge.stop();
+
+    std::vector<double> latencies;
+    size_t failures = 0;
+    uint64_t requests = 0, reused = 0;
+    for (const auto& outcome : outcomes) {
+        latencies.insert(latencies.end(), outcome.latencies.begin(), outcome.latencies.end());
+        failures += outcome.failures;
+        requests += outcome.metrics.requests;
+        reused += outcome.metrics.reused_connections;
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    size_t completed = latencies.size() * options.batch;
+    std::printf("controllers: %zu x %zu commands (%s %zu, %s)\n", options.controllers,
+                options.commands, options.async ? "async" : "batch", options.batch,
+                options.encoding == control::protocol::Encoding::Json ? "json" : "msgpack");
+    std::printf("bridge:      frame %.2fms, latency %.2fms, jitter %.2fms, %llu frames\n",
+                options.bridge.frame_ms, options.bridge.latency_ms, options.bridge.jitter_ms,
+                static_cast<unsigned long long>(bridge.frames()));
+    std::printf("completed:   %zu commands, %zu failed round-trips\n", completed, failures);
+    std::printf("throughput:  %.0f cmds/s\n", double(completed) / elapsed_s);
+    std::printf("round-trip:  p50 %.3fms  p99 %.3fms  max %.3fms\n", percentile(latencies, 0.50),
+                percentile(latencies, 0.99), latencies.empty() ? 0.0 : latencies.back());
+    std::printf("http:        %llu requests, %.1f%% over reused connections\n",
+                static_cast<unsigned long long>(requests),
+                requests ? 100.0 * double(reused) / double(requests) : 0.0);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,449 @@
+// Benchmarks for the Memory search primitives.
+//
+// Everything runs against a synthetic heap that lives in this process: a fake PE image (headers,
+// .rdata with x64 RTTI, .data with globals) followed by Roblox-like objects. Memory reads it
+// through a LocalBackend wrapped in a counter, so the numbers reflect the search loops
+// themselves and can be tracked per commit on any host.
+//
+//   roblox-dumper-bench [--filter <substring>] [--min-time-ms <ms>] [--json]
+
+#include "memory/backend.h"
+#include "memory/memory.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    class CountingBackend : public MemoryBackend {
+      public:
+        LocalBackend local;
+        uint64_t reads = 0;
+
+        bool read(uintptr_t address, void* buffer, size_t size) override {
+            reads++;
+            return local.read(address, buffer, size);
+        }
+    };
+
+    // Bump allocator over one contiguous buffer. The first IMAGE_SIZE bytes are the module.
+    class Arena {
+      public:
+        explicit Arena(size_t size) : storage(size + 0x10000) {
+            uintptr_t raw = reinterpret_cast<uintptr_t>(storage.data());
+            start = (raw + 0xFFFF) & ~uintptr_t(0xFFFF);
+            capacity = size;
+        }
+
+        uintptr_t base() const { return start; }
+        size_t size() const { return capacity; }
+
+        uintptr_t alloc(size_t size, size_t align = 0x10) {
+            used = (used + align - 1) & ~(align - 1);
+            uintptr_t address = start + used;
+            used += size;
+            if (used > capacity) {
+                std::fprintf(stderr, "synthetic heap exhausted\n");
+                std::exit(1);
+            }
+            return address;
+        }
+
+        void skip_to(size_t offset) { used = offset; }
+
+        template <typename T> void write(uintptr_t address, const T& value) {
+            std::memcpy(reinterpret_cast<void*>(address), &value, sizeof(T));
+        }
+
+        void write_bytes(uintptr_t address, const void* data, size_t size) {
+            std::memcpy(reinterpret_cast<void*>(address), data, size);
+        }
+
+      private:
+        std::vector<uint8_t> storage;
+        uintptr_t start = 0;
+        size_t capacity = 0;
+        size_t used = 0;
+    };
+
+    constexpr size_t RDATA_RVA = 0x1000;
+    constexpr size_t RDATA_SIZE = 0x40000;
+    constexpr size_t DATA_RVA = RDATA_RVA + RDATA_SIZE;
+    constexpr size_t DATA_SIZE = 0x200000;
+    constexpr size_t IMAGE_SIZE = DATA_RVA + DATA_SIZE;
+
+    struct SyntheticHeap {
+        Arena arena{IMAGE_SIZE + 0x1000000};
+        std::mt19937_64 rng{0x5EED};
+        size_t rdata_used = 0;
+        std::vector<uintptr_t> plain_blocks;
+        std::vector<uintptr_t> rtti_objects;
+
+        uintptr_t rva(size_t offset) const { return arena.base() + offset; }
+
+        void build_image_headers() {
+            IMAGE_DOS_HEADER dos{};
+            dos.e_magic = IMAGE_DOS_SIGNATURE;
+            dos.e_lfanew = 0x80;
+            arena.write(rva(0), dos);
+
+            IMAGE_NT_HEADERS64 nt{};
+            nt.Signature = IMAGE_NT_SIGNATURE;
+            nt.FileHeader.NumberOfSections = 2;
+            nt.FileHeader.SizeOfOptionalHeader = sizeof(IMAGE_OPTIONAL_HEADER64);
+            nt.OptionalHeader.SizeOfImage = IMAGE_SIZE;
+            arena.write(rva(0x80), nt);
+
+            IMAGE_SECTION_HEADER sections[2]{};
+            std::memcpy(sections[0].Name, ".rdata", 6);
+            sections[0].VirtualAddress = RDATA_RVA;
+            sections[0].Misc.VirtualSize = RDATA_SIZE;
+            std::memcpy(sections[1].Name, ".data", 5);
+            sections[1].VirtualAddress = DATA_RVA;
+            sections[1].Misc.VirtualSize = DATA_SIZE;
+            arena.write_bytes(rva(0x80 + sizeof(IMAGE_NT_HEADERS64)), sections, sizeof(sections));
+
+            arena.skip_to(IMAGE_SIZE);
+        }
+
+        uintptr_t rdata_alloc(size_t size) {
+            rdata_used = (rdata_used + 0xF) & ~size_t(0xF);
+            uintptr_t address = rva(RDATA_RVA + rdata_used);
+            rdata_used += size;
+            return address;
+        }
+
+        // TypeDescriptor + x64 COL + vtable, returns the vtable address objects point at.
+        uintptr_t make_class(const std::string& name) {
+            uintptr_t type_descriptor = rdata_alloc(sizeof(TypeDescriptor));
+            std::string mangled = ".?AV" + name + "@@";
+            arena.write_bytes(type_descriptor + 0x10, mangled.c_str(), mangled.size() + 1);
+
+            uintptr_t hierarchy = rdata_alloc(sizeof(RTTIClassHierarchyDescriptor));
+
+            uintptr_t col = rdata_alloc(0x18);
+            arena.write<DWORD>(col + 0x0, 1);
+            arena.write<int>(col + 0xC, int(type_descriptor - arena.base()));
+            arena.write<int>(col + 0x10, int(hierarchy - arena.base()));
+            arena.write<int>(col + 0x14, int(col - arena.base()));
+
+            uintptr_t vtable_slot = rdata_alloc(0x8 * 8);
+            arena.write<uintptr_t>(vtable_slot, col);
+            return vtable_slot + 0x8;
+        }
+
+        // Search targets pass pooled = false so noise never references them ahead of the
+        // planted slot.
+        uintptr_t make_object(uintptr_t vtable, size_t size, bool pooled = true) {
+            uintptr_t object = arena.alloc(size);
+            arena.write<uintptr_t>(object, vtable);
+            if (pooled)
+                rtti_objects.push_back(object);
+            return object;
+        }
+
+        // Roblox std::string: inline buffer below 16 chars, heap pointer otherwise, length at 0x18.
+        uintptr_t make_roblox_string(const std::string& value) {
+            uintptr_t object = arena.alloc(0x20);
+            if (value.size() < 16) {
+                arena.write_bytes(object, value.c_str(), value.size() + 1);
+            } else {
+                uintptr_t data = make_c_string(value);
+                arena.write<uintptr_t>(object, data);
+            }
+            arena.write<int32_t>(object + 0x18, int32_t(value.size()));
+            return object;
+        }
+
+        uintptr_t make_c_string(const std::string& value) {
+            uintptr_t data = arena.alloc(value.size() + 1);
+            arena.write_bytes(data, value.c_str(), value.size() + 1);
+            return data;
+        }
+
+        uintptr_t make_plain_block(size_t size) {
+            uintptr_t block = arena.alloc(size);
+            fill_scalars(block, size);
+            plain_blocks.push_back(block);
+            return block;
+        }
+
+        // Children vector the way Instance::ChildrenStart points at it: {begin, end} of
+        // {child, refcount} pairs.
+        uintptr_t make_children(const std::vector<uintptr_t>& children) {
+            uintptr_t nodes = arena.alloc(children.size() * 0x10 + 0x10);
+            for (size_t i = 0; i < children.size(); i++)
+                arena.write<uintptr_t>(nodes + i * 0x10, children[i]);
+            uintptr_t vector = arena.alloc(0x18);
+            arena.write<uintptr_t>(vector, nodes);
+            arena.write<uintptr_t>(vector + 0x8, nodes + children.size() * 0x10);
+            return vector;
+        }
+
+        void fill_scalars(uintptr_t address, size_t size) {
+            for (size_t off = 0; off + 4 <= size; off += 4) {
+                switch (rng() % 4) {
+                    case 0:
+                        arena.write<uint32_t>(address + off, 0);
+                        break;
+                    case 1:
+                        arena.write<uint32_t>(address + off, uint32_t(rng() % 256));
+                        break;
+                    default:
+                        arena.write<float>(address + off,
+                                           float(rng() % 100000) / 100.0f + 1000.0f);
+                        break;
+                }
+            }
+        }
+
+        // Instance-ish body: scalar noise with pointers to other objects, strings and plain
+        // blocks sprinkled in, so pointer-chasing primitives pay realistic costs.
+        void fill_instance(uintptr_t object, size_t size, size_t first_field = 0x8) {
+            fill_scalars(object + first_field, size - first_field);
+            for (size_t off = first_field; off + 8 <= size; off += 8) {
+                uint64_t roll = rng() % 8;
+                if (roll == 0 && !rtti_objects.empty())
+                    arena.write<uintptr_t>(object + off, rtti_objects[rng() % rtti_objects.size()]);
+                else if (roll == 1 && !plain_blocks.empty())
+                    arena.write<uintptr_t>(object + off, plain_blocks[rng() % plain_blocks.size()]);
+            }
+        }
+    };
+
+    struct Result {
+        std::string name;
+        size_t slots = 0;
+        double ns_per_call = 0;
+        double reads_per_call = 0;
+    };
+
+    struct Bench {
+        std::string name;
+        size_t slots;
+        std::function<bool()> run;
+    };
+
+    Result measure(const Bench& bench, CountingBackend& counter, double min_time_ms) {
+        using clock = std::chrono::steady_clock;
+
+        Result result;
+        result.name = bench.name;
+        result.slots = bench.slots;
+
+        counter.reads = 0;
+        if (!bench.run()) {
+            std::fprintf(stderr, "%s: search returned the wrong offset\n", bench.name.c_str());
+            std::exit(1);
+        }
+
+        uint64_t iterations = 0;
+        counter.reads = 0;
+        auto start = clock::now();
+        double elapsed_ms = 0;
+        do {
+            bench.run();
+            iterations++;
+            elapsed_ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+        } while (elapsed_ms < min_time_ms);
+
+        result.ns_per_call = elapsed_ms * 1e6 / double(iterations);
+        result.reads_per_call = double(counter.reads) / double(iterations);
+        return result;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string filter;
+    double min_time_ms = 250.0;
+    bool json = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--min-time-ms" && i + 1 < argc) {
+            min_time_ms = std::stod(argv[++i]);
+        } else if (arg == "--json") {
+            json = true;
+        } else {
+            std::fprintf(stderr, "usage: %s [--filter <substring>] [--min-time-ms <ms>] [--json]\n",
+                         argv[0]);
+            return 1;
+        }
+    }
+
+    SyntheticHeap heap;
+    heap.build_image_headers();
+
+    auto backend = std::make_unique<CountingBackend>();
+    backend->local.add_region(reinterpret_cast<void*>(heap.arena.base()), heap.arena.size());
+    CountingBackend& counter = *backend;
+    Memory mem(std::move(backend), heap.arena.base());
+
+    // background population: unrelated classes, plain blocks and strings
+    std::vector<uintptr_t> noise_classes;
+    for (const char* name : {"Part@RBX", "Model@RBX", "Folder@RBX", "Script@RBX",
+                             "Attachment@RBX", "Weld@RBX", "Decal@RBX", "Sound@RBX"})
+        noise_classes.push_back(heap.make_class(name));
+    for (int i = 0; i < 256; i++)
+        heap.make_plain_block(0x40);
+    for (int i = 0; i < 512; i++) {
+        uintptr_t object = heap.make_object(noise_classes[i % noise_classes.size()], 0x100);
+        heap.fill_instance(object, 0x100);
+    }
+
+    std::vector<Bench> benches;
+
+    // find_value_offset: DataModel-sized block, u64 PlaceId near the end
+    {
+        constexpr size_t WINDOW = 0x1000;
+        constexpr size_t TARGET = 0xE08;
+        constexpr uint64_t PLACE_ID = 6923982205;
+        uintptr_t data_model = heap.make_object(heap.make_class("DataModel@RBX"), WINDOW);
+        heap.fill_instance(data_model, WINDOW);
+        heap.arena.write<uint64_t>(data_model + TARGET, PLACE_ID);
+
+        benches.push_back({"find_value_offset<u64>", WINDOW / 0x8, [=, &mem] {
+                               return mem.find_value_offset<uint64_t>(data_model, PLACE_ID) ==
+                                      TARGET;
+                           }});
+        // a re-dump where PlaceId moved two slots since the seeded dump
+        benches.push_back({"find_value_offset<u64>/hinted", WINDOW / 0x8, [=, &mem] {
+                               return mem.find_value_offset<uint64_t>(data_model, PLACE_ID, WINDOW,
+                                                                      0x8, 0, {},
+                                                                      TARGET - 0x10) == TARGET;
+                           }});
+    }
+
+    // find_verified_offset_float: two Humanoid-like float blocks
+    {
+        constexpr size_t WINDOW = 0x800;
+        constexpr size_t TARGET = 0x7A4;
+        uintptr_t humanoid_class = heap.make_class("Humanoid@RBX");
+        uintptr_t humanoid1 = heap.make_object(humanoid_class, WINDOW);
+        uintptr_t humanoid2 = heap.make_object(humanoid_class, WINDOW);
+        heap.fill_instance(humanoid1, WINDOW);
+        heap.fill_instance(humanoid2, WINDOW);
+        heap.arena.write<float>(humanoid1 + TARGET, 298.0f);
+        heap.arena.write<float>(humanoid2 + TARGET, 28.0f);
+
+        benches.push_back({"find_verified_offset_float", WINDOW / 0x4,
+                           [=, &mem] {
+                               return mem.find_verified_offset_float({humanoid1, humanoid2},
+                                                                     {298.0f, 28.0f}, WINDOW,
+                                                                     0x4) == TARGET;
+                           }});
+        benches.push_back({"find_verified_offset_float/hinted", WINDOW / 0x4,
+                           [=, &mem] {
+                               return mem.find_verified_offset_float({humanoid1, humanoid2},
+                                                                     {298.0f, 28.0f}, WINDOW, 0x4,
+                                                                     0.01f, TARGET + 0x8) == TARGET;
+                           }});
+    }
+
+    // find_rtti_offset: pointer-dense object, target class late in the window
+    {
+        constexpr size_t WINDOW = 0x1000;
+        constexpr size_t TARGET = 0xC00;
+        uintptr_t primitive = heap.make_object(heap.make_class("Primitive@RBX"), 0x200, false);
+        uintptr_t part = heap.make_object(noise_classes[0], WINDOW);
+        heap.fill_instance(part, WINDOW);
+        heap.arena.write<uintptr_t>(part + TARGET, primitive);
+
+        benches.push_back({"find_rtti_offset", WINDOW / 0x8, [=, &mem] {
+                               return mem.find_rtti_offset(part, "Primitive@RBX") == TARGET;
+                           }});
+    }
+
+    // scan_roblox_string: Instance with Name behind a pointer, other string fields before it
+    {
+        constexpr size_t WINDOW = 0x200;
+        constexpr size_t TARGET = 0x1B0;
+        uintptr_t workspace = heap.make_object(heap.make_class("Workspace@RBX"), 0x400);
+        heap.fill_instance(workspace, 0x400);
+        for (size_t off = 0x40; off < TARGET; off += 0x40)
+            heap.arena.write<uintptr_t>(workspace + off,
+                                        heap.make_roblox_string("NotTheName" + std::to_string(off)));
+        heap.arena.write<uintptr_t>(workspace + 0x70, heap.make_children(heap.rtti_objects));
+        heap.arena.write<uintptr_t>(workspace + TARGET, heap.make_roblox_string("Workspace"));
+
+        benches.push_back({"scan_roblox_string", WINDOW / 0x8, [=, &mem] {
+                               auto info = mem.scan_roblox_string(workspace, "Workspace");
+                               return info && info->pointer_offset == TARGET;
+                           }});
+    }
+
+    // find_string_by_regex: JobId-style UUID behind a pointer
+    {
+        constexpr size_t WINDOW = 0x200;
+        constexpr size_t TARGET = 0x1F0;
+        uintptr_t data_model = heap.make_object(heap.make_class("DataModel@RBX"), 0x400);
+        heap.fill_instance(data_model, 0x400);
+        for (size_t off = 0x18; off < TARGET; off += 0x30)
+            heap.arena.write<uintptr_t>(data_model + off,
+                                        heap.make_c_string("RobloxPlayerBeta_" + std::to_string(off)));
+        heap.arena.write<uintptr_t>(data_model + TARGET,
+                                    heap.make_c_string("1b4e28ba-2fa1-11d2-883f-0016d3cca427"));
+
+        benches.push_back({"find_string_by_regex", WINDOW / 0x8, [=, &mem] {
+                               return mem.find_string_by_regex(
+                                          data_model,
+                                          R"([0-9a-f]{8}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{12})",
+                                          WINDOW, 0x8, 64) == TARGET;
+                           }});
+    }
+
+    // find_pointer_by_rtti: sparse .data full of globals, VisualEngine pointer near the end
+    {
+        const size_t target = DATA_RVA + ((DATA_SIZE / 10) * 9 & ~size_t(0x7));
+        uintptr_t visual_engine =
+            heap.make_object(heap.make_class("VisualEngine@Graphics@RBX"), 0x800, false);
+        for (size_t off = 0; off < DATA_SIZE; off += 0x8) {
+            uint64_t roll = heap.rng() % 10;
+            uintptr_t slot = heap.rva(DATA_RVA + off);
+            if (roll == 0)
+                heap.arena.write<uintptr_t>(slot, heap.rtti_objects[heap.rng() % heap.rtti_objects.size()]);
+            else if (roll == 1)
+                heap.arena.write<uintptr_t>(slot, heap.plain_blocks[heap.rng() % heap.plain_blocks.size()]);
+            else if (roll < 4)
+                heap.arena.write<uint64_t>(slot, heap.rng() % 0x10000);
+        }
+        heap.arena.write<uintptr_t>(heap.rva(target), visual_engine);
+
+        benches.push_back({"find_pointer_by_rtti", DATA_SIZE / 0x8, [=, &mem] {
+                               return mem.find_pointer_by_rtti("VisualEngine@Graphics@RBX") ==
+                                      target;
+                           }});
+    }
+
+    if (!json)
+        std::printf("%-36s %8s %12s %10s %11s\n", "benchmark", "slots", "ns/call", "ns/slot",
+                    "reads/slot");
+
+    for (const auto& bench : benches) {
+        if (!filter.empty() && bench.name.find(filter) == std::string::npos)
+            continue;
+
+        Result r = measure(bench, counter, min_time_ms);
+        double ns_per_slot = r.ns_per_call / double(r.slots);
+        double reads_per_slot = r.reads_per_call / double(r.slots);
+
+        if (json) {
+            std::printf("{\"benchmark\":\"%s\",\"slots\":%zu,\"ns_per_call\":%.1f,"
+                        "\"ns_per_slot\":%.3f,\"reads_per_slot\":%.3f}\n",
+                        r.name.c_str(), r.slots, r.ns_per_call, ns_per_slot, reads_per_slot);
+        } else {
+            std::printf("%-36s %8zu %12.1f %10.3f %11.3f\n", r.name.c_str(), r.slots,
+                        r.ns_per_call, ns_per_slot, reads_per_slot);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+// Benchmark for consuming a dump: offsets.json through nlohmann::json versus offsets.bin through
+// offset_table::Reader.
+//
+// Both files are generated in memory from the same synthetic dump, sized like a real one. "load"
+// is what a consumer pays at startup to be able to answer lookups at all (parse the JSON, or
+// validate the mapped table); "lookup" resolves every offset once from the loaded state.
+//
+//   roblox-dumper-table-bench [--offsets <n>] [--min-time-ms <ms>] [--json]
+
+#include "utils/offset_file.hpp"
+#include "utils/offset_table.hpp"
+#include "utils/offset_table_writer.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Result {
+        std::string name;
+        double ns_per_call = 0;
+    };
+
+    Result measure(const std::string& name, const std::function<bool()>& run, double min_time_ms) {
+        using clock = std::chrono::steady_clock;
+
+        if (!run()) {
+            std::fprintf(stderr, "%s: lookup returned the wrong offset\n", name.c_str());
+            std::exit(1);
+        }
+
+        uint64_t iterations = 0;
+        auto start = clock::now();
+        double elapsed_ms = 0;
+        do {
+            run();
+            iterations++;
+            elapsed_ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+        } while (elapsed_ms < min_time_ms);
+
+        return {name, elapsed_ms * 1e6 / double(iterations)};
+    }
+
+    // namespaces and names shaped like the real dump: a few dozen classes, mostly short
+    // CamelCase property names
+    offset_file::Dump make_dump(size_t offsets) {
+        static const char* classes[] = {
+            "Instance",  "BasePart", "Humanoid",     "Camera",   "Lighting", "GuiObject",
+            "TextLabel", "Tool",     "Player",       "Workspace", "Sky",     "Atmosphere",
+            "MeshPart",  "Terrain",  "VisualEngine", "DataModel", "Script",  "ProximityPrompt",
+        };
+        static const char* properties[] = {"Position", "Size",    "Color",   "Transparency",
+                                           "Enabled",  "Visible", "Name",    "Parent",
+                                           "Velocity", "Anchored", "Text",   "Rotation"};
+
+        offset_file::Dump dump;
+        dump.roblox_version = "version-0000000000000000";
+        for (size_t i = 0; i < offsets; i++) {
+            std::string ns = classes[i % std::size(classes)];
+            std::string name = std::string(properties[(i / std::size(classes)) %
+                                                      std::size(properties)]) +
+                               std::to_string(i / (std::size(classes) * std::size(properties)));
+            if (!dump.namespaces.count(ns))
+                dump.namespace_order.push_back(ns);
+            dump.namespaces[ns][name] = 0x10 + 8 * i;
+        }
+        return dump;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t offsets = 800;
+    double min_time_ms = 250.0;
+    bool json = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--offsets") && i + 1 < argc) {
+            offsets = std::strtoull(argv[++i], nullptr, 10);
+        } else if (!std::strcmp(argv[i], "--min-time-ms") && i + 1 < argc) {
+            min_time_ms = std::atof(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--json")) {
+            json = true;
+        } else {
+            std::fprintf(stderr, "usage: %s [--offsets <n>] [--min-time-ms <ms>] [--json]\n",
+                         argv[0]);
+            return 1;
+        }
+    }
+
+    offset_file::Dump dump = make_dump(offsets);
+    struct Key {
+        std::string ns;
+        std::string name;
+        uintptr_t value;
+    };
+    std::vector<Key> keys;
+    for (const auto& [ns, entries] : dump.namespaces)
+        for (const auto& [name, value] : entries)
+            keys.push_back({ns, name, value});
+
+    nlohmann::ordered_json document = {
+        {"metadata", {{"roblox_version", dump.roblox_version}, {"total_offsets", keys.size()}}},
+        {"offsets", offset_file::offsets_to_json(dump)},
+    };
+    const std::string json_file = document.dump(4);
+
+    auto table_file = offset_table::build(dump);
+    if (!table_file) {
+        std::fprintf(stderr, "failed to build the offset table\n");
+        return 1;
+    }
+
+    nlohmann::json parsed = nlohmann::json::parse(json_file);
+    offset_table::Reader table;
+    table.open(table_file->data(), table_file->size());
+
+    std::vector<Result> results;
+    results.push_back(measure(
+        "json/load",
+        [&] {
+            auto loaded = nlohmann::json::parse(json_file);
+            return loaded["offsets"].size() == dump.namespaces.size();
+        },
+        min_time_ms));
+    results.push_back(measure(
+        "table/load",
+        [&] {
+            offset_table::Reader reader;
+            return reader.open(table_file->data(), table_file->size()) &&
+                   reader.size() == keys.size();
+        },
+        min_time_ms));
+    results.push_back(measure(
+        "json/lookup",
+        [&] {
+            const auto& root = parsed["offsets"];
+            bool ok = true;
+            for (const auto& key : keys)
+                ok &= root[key.ns][key.name].get<uintptr_t>() == key.value;
+            return ok;
+        },
+        min_time_ms));
+    results.push_back(measure(
+        "table/lookup",
+        [&] {
+            bool ok = true;
+            for (const auto& key : keys)
+                ok &= table.find(key.ns, key.name) == key.value;
+            return ok;
+        },
+        min_time_ms));
+
+    if (!json) {
+        std::printf("%zu offsets, offsets.json %zu bytes, offsets.bin %zu bytes\n", keys.size(),
+                    json_file.size(), table_file->size());
+        std::printf("%-16s %14s %12s\n", "benchmark", "ns/call", "ns/offset");
+    }
+    for (const auto& r : results) {
+        double per_offset = r.ns_per_call / double(keys.size());
+        if (json) {
+            std::printf("{\"benchmark\":\"%s\",\"offsets\":%zu,\"ns_per_call\":%.1f,"
+                        "\"ns_per_offset\":%.3f}\n",
+                        r.name.c_str(), keys.size(), r.ns_per_call, per_offset);
+        } else {
+            std::printf("%-16s %14.1f %12.3f\n", r.name.c_str(), r.ns_per_call, per_offset);
+        }
+    }
+
+    return 0;
+}
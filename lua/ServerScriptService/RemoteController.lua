@@ -5,6 +5,7 @@ local Workspace = game:GetService("Workspace")
 local ReplicatedStorage = game:GetService("ReplicatedStorage")
 local Teams = game:GetService("Teams")
 local Players = game:GetService("Players")
+local RunService = game:GetService("RunService")
 
 local API_URL = nil
 
@@ -33,6 +34,13 @@ prompt.Parent = promptPart
 
 promptPart.Parent = ReplicatedStorage
 
+-- Frame counter for sweeps: "<token>:<step>" once that step of sweep <token> has been applied.
+-- It is set in the same frame as the step, so it replicates alongside the change.
+local sweepFrame = Instance.new("StringValue")
+sweepFrame.Name = "SweepFrame"
+sweepFrame.Value = "idle"
+sweepFrame.Parent = ReplicatedStorage
+
 local plasticFloor = Instance.new("Part")
 plasticFloor.Name = "PlasticFloor"
 plasticFloor.Material = Enum.Material.Plastic
@@ -122,11 +130,76 @@ local function getScreenGuiFrame()
 	return frame
 end
 
-local function handleCommand(cmd)
+local handleCommand
+
+-- Runs every entry of a batch back to back without yielding, so they all land in the same frame,
+-- then reports one result array in entry order. Entries that yield (continuous jump, client GUI
+-- info) still work but push the rest of the batch into later frames.
+local function handleBatch(commandId, commands)
+	local results = {}
+	local allCompleted = true
+
+	for i, entry in ipairs(commands) do
+		handleCommand({id = commandId .. "#" .. i, action = entry.action, data = entry.data},
+			function(_, status, result)
+				results[i] = {status = status, result = result}
+			end)
+
+		if not results[i] then
+			results[i] = {status = "failed", result = {error = "Unknown action " .. tostring(entry.action)}}
+		end
+		if results[i].status ~= "completed" then
+			allCompleted = false
+		end
+	end
+
+	submitResult(commandId, allCompleted and "completed" or "failed", {results = results})
+end
+
+-- Applies one step per Heartbeat and publishes the step number through SweepFrame, so the
+-- dumper can snapshot memory in lockstep instead of waiting on a round-trip per value.
+local function handleSweep(commandId, data)
+	local results = {}
+	local allCompleted = true
+
+	for i, step in ipairs(data.steps) do
+		handleCommand({id = commandId .. "#" .. i, action = step.action, data = step.data},
+			function(_, status, result)
+				results[i] = {status = status, result = result}
+			end)
+
+		if not results[i] then
+			results[i] = {status = "failed", result = {error = "Unknown action " .. tostring(step.action)}}
+		end
+		if results[i].status ~= "completed" then
+			allCompleted = false
+		end
+
+		sweepFrame.Value = tostring(data.token) .. ":" .. i
+		RunService.Heartbeat:Wait()
+	end
+
+	submitResult(commandId, allCompleted and "completed" or "failed", {results = results})
+end
+
+-- reply replaces submitResult for this command; batches use it to collect results instead of
+-- posting each one
+function handleCommand(cmd, reply)
+	local submitResult = reply or submitResult
 	local action = cmd.action
 	local data = cmd.data
 	local commandId = cmd.id
 
+	if action == "batch" then
+		handleBatch(commandId, data.commands)
+		return
+	end
+
+	if action == "sweep" then
+		handleSweep(commandId, data)
+		return
+	end
+
 	local function run(f)
 		local s, e = pcall(f)
 		if s then
@@ -455,27 +528,184 @@ local function handleCommand(cmd)
 	end
 end
 
+-- /poll and /stream are asked for ?schema=compact: the common numeric setters then arrive as
+-- {id, opcode, field...} arrays instead of objects. Index = opcode; this must stay in sync with
+-- COMMAND_SCHEMAS in src/control/protocol.hpp.
+local COMPACT_SCHEMAS = {
+	{"set_gravity", {"value"}},
+	{"set_camera_fov", {"value"}},
+	{"set_camera_position", {"x", "y", "z"}},
+	{"set_camera_rotation", {"x", "y", "z"}},
+	{"set_skybox_orientation", {"x", "y", "z"}},
+	{"set_frame_position", {"x_scale", "x_offset", "y_scale", "y_offset"}},
+	{"set_frame_size", {"x_scale", "x_offset", "y_scale", "y_offset"}},
+	{"set_frame_visible", {"value"}},
+	{"set_tool_grip_pos", {"x", "y", "z"}},
+	{"set_tool_can_be_dropped", {"value"}},
+	{"set_tool_enabled", {"value"}},
+	{"set_tool_manual_activation", {"value"}},
+	{"set_tool_requires_handle", {"value"}},
+	{"set_highlight_depth_mode", {"value"}},
+	{"set_proximity_prompt_enabled", {"value"}},
+	{"set_proximity_prompt_requires_line_of_sight", {"value"}},
+	{"set_npc_auto_rotate", {"value"}},
+	{"set_npc_auto_jump_enabled", {"value"}},
+	{"set_npc_break_joints_on_death", {"value"}},
+	{"set_npc_requires_neck", {"value"}},
+	{"set_npc_use_jump_power", {"value"}},
+	{"set_npc_move_direction", {"x", "y", "z"}},
+}
+
+local function expandCommand(entry)
+	if type(entry) ~= "table" then
+		return nil
+	end
+	if entry.action then
+		return entry
+	end
+
+	local schema = COMPACT_SCHEMAS[entry[2]]
+	if not schema then
+		return nil
+	end
+	local data = {}
+	for i, field in ipairs(schema[2]) do
+		data[field] = entry[i + 2]
+	end
+	return {id = entry[1], action = schema[1], data = data}
+end
+
+-- a /stream that drops mid-write hands its commands back to the queue, so the same id can
+-- arrive twice; remember the last few ids and run each one only once
+local RECENT_COMMAND_LIMIT = 256
+local recentCommands = {}
+local recentOrder = {}
+
+local function alreadyRan(id)
+	if id == nil then
+		return false
+	end
+	if recentCommands[id] then
+		return true
+	end
+	recentCommands[id] = true
+	table.insert(recentOrder, id)
+	if #recentOrder > RECENT_COMMAND_LIMIT then
+		recentCommands[table.remove(recentOrder, 1)] = nil
+	end
+	return false
+end
+
+local function runCommand(entry)
+	local cmd = expandCommand(entry)
+	if cmd and not alreadyRan(cmd.id) then
+		task.spawn(function()
+			handleCommand(cmd)
+		end)
+	end
+end
+
+-- the server holds /poll open until a command is queued (or LONG_POLL_MS passes), so commands
+-- are picked up the moment they arrive and an idle loop costs one request per LONG_POLL_MS
+local LONG_POLL_MS = 10000
+
 local function pollCommands()
 	local s, response = pcall(function()
-		return HttpService:GetAsync(API_URL .. "/poll")
+		return HttpService:GetAsync(API_URL .. "/poll?schema=compact&wait=" .. LONG_POLL_MS, true)
 	end)
 	if s then
 		local data = HttpService:JSONDecode(response)
-		for _, cmd in ipairs(data.commands) do
-			task.spawn(function()
-				handleCommand(cmd)
-			end)
+		for _, entry in ipairs(data.commands) do
+			runCommand(entry)
+		end
+	end
+	return s
+end
+
+-- Preferred transport: one long-lived /stream response that carries every command as an NDJSON
+-- line as soon as it is queued. Needs HttpService:CreateWebStreamClient; when that is missing or
+-- the stream drops, the loop below falls back to /poll and tries the stream again later.
+local STREAM_RETRY_SECONDS = 10
+
+local stream = nil
+local streamUnsupported = false
+
+local function handleStreamLine(line)
+	local decoded, entry = pcall(function()
+		return HttpService:JSONDecode(line)
+	end)
+	-- heartbeats have no action and expand to nothing
+	if decoded then
+		runCommand(entry)
+	end
+end
+
+local function openStream()
+	local s, client = pcall(function()
+		return HttpService:CreateWebStreamClient(Enum.WebStreamClientType.RawStream, {
+			Url = API_URL .. "/stream?schema=compact",
+			Method = "GET",
+		})
+	end)
+	if not s then
+		print("[Controller] Streaming unavailable, using /poll:", tostring(client))
+		streamUnsupported = true
+		return
+	end
+
+	-- chunks do not line up with lines, so keep the unfinished tail around
+	local buffer = ""
+	client.MessageReceived:Connect(function(message)
+		buffer = buffer .. message
+		while true do
+			local newline = string.find(buffer, "\n", 1, true)
+			if not newline then
+				break
+			end
+			handleStreamLine(string.sub(buffer, 1, newline - 1))
+			buffer = string.sub(buffer, newline + 1)
+		end
+	end)
+
+	local function dropped(reason)
+		if stream == client then
+			print("[Controller] Stream closed, falling back to /poll:", tostring(reason))
+			stream = nil
 		end
 	end
+	client.Error:Connect(function(_, message)
+		dropped(message)
+	end)
+	client.Closed:Connect(function()
+		dropped("closed")
+	end)
+
+	stream = client
+	print("[Controller] Streaming commands from:", API_URL .. "/stream")
 end
 
 startEvent.OnServerEvent:Connect(function(player, url)
 	API_URL = url
 	print("[Controller] Started polling at:", url)
 	task.spawn(function()
+		local nextStreamAttempt = 0
 		while API_URL do
-			pollCommands()
-			task.wait(0.1)
+			if not stream and not streamUnsupported and os.clock() >= nextStreamAttempt then
+				nextStreamAttempt = os.clock() + STREAM_RETRY_SECONDS
+				openStream()
+			end
+
+			if stream then
+				-- commands arrive through MessageReceived; just keep an eye on the connection
+				task.wait(1)
+			elseif not pollCommands() then
+				-- server unreachable; back off instead of spinning on failed requests
+				task.wait(1)
+			end
+		end
+		if stream then
+			stream:Close()
+			stream = nil
 		end
 	end)
 end)
@@ -1,34 +1,114 @@
 #include "control.hpp"
+#include "utils/event_log.hpp"
 #include "utils/logger.hpp"
+#include <algorithm>
 #include <cpr/cpr.h>
+#include <curl/curl.h>
 
 namespace control {
     Controller::Controller(const std::string& api_url) : api_url(api_url) {}
 
+    Controller::~Controller() {
+        {
+            std::lock_guard<std::mutex> lock(async_mutex);
+            io_stop = true;
+        }
+        async_cv.notify_all();
+        if (io_thread.joinable())
+            io_thread.join();
+    }
+
+    Controller& shared_controller() {
+        static Controller controller("http://localhost:8000");
+        return controller;
+    }
+
+    cpr::Response Controller::request(bool post, const std::string& path,
+                                      const nlohmann::json& body) {
+        std::unique_ptr<cpr::Session> session;
+        std::string url;
+        protocol::Encoding body_encoding;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            url = api_url + path;
+            body_encoding = encoding;
+            if (!idle_sessions.empty()) {
+                session = std::move(idle_sessions.back());
+                idle_sessions.pop_back();
+            }
+        }
+        if (!session)
+            session = std::make_unique<cpr::Session>();
+
+        auto start = std::chrono::steady_clock::now();
+
+        std::string content_type(protocol::content_type(body_encoding));
+        session->SetUrl(cpr::Url{url});
+        session->SetHeader(cpr::Header{{"Content-Type", content_type}, {"Accept", content_type}});
+        session->SetBody(cpr::Body{body.is_null() ? "" : protocol::encode(body, body_encoding)});
+        cpr::Response response = post ? session->Post() : session->Get();
+
+        double latency_ms = std::chrono::duration<double, std::milli>(
+                                std::chrono::steady_clock::now() - start)
+                                .count();
+
+        if (event_log::enabled()) {
+            std::string action = body.is_object() ? body.value("action", "") : "";
+            event_log::request(post ? "POST" : "GET", path, action, response.status_code,
+                               !response.error, latency_ms);
+        }
+
+        // libcurl counts the connections it had to open for this transfer; zero means the
+        // request went out over a kept-alive one
+        long new_connections = 0;
+        curl_easy_getinfo(session->GetCurlHolder()->handle, CURLINFO_NUM_CONNECTS,
+                          &new_connections);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.requests++;
+        stats.total_latency_ms += latency_ms;
+        stats.max_latency_ms = (std::max)(stats.max_latency_ms, latency_ms);
+        if (response.error) {
+            stats.failed_requests++;
+        } else if (new_connections == 0) {
+            stats.reused_connections++;
+        }
+
+        if (!response.error && idle_sessions.size() < MAX_IDLE_SESSIONS)
+            idle_sessions.push_back(std::move(session));
+
+        return response;
+    }
+
+    // The server answers in whatever encoding the request asked for, but trust the header.
+    nlohmann::json Controller::decode(cpr::Response& response) {
+        return protocol::decode(response.text,
+                                protocol::encoding_from_header(response.header["Content-Type"]));
+    }
+
     std::string Controller::send_command(const std::string& action, const nlohmann::json& data) {
         nlohmann::json payload = {{"action", action}, {"data", data}};
 
-        LOG_INFO("Sending command: {} with data: {}", action, data.dump());
+        LOG_DEBUG("Sending command: {} with data: {}", action, data.dump());
 
-        auto response =
-            cpr::Post(cpr::Url{api_url + "/execute"},
-                      cpr::Header{{"Content-Type", "application/json"}}, cpr::Body{payload.dump()});
+        auto response = request(true, "/execute", payload);
 
         if (response.status_code == 200) {
-            auto json_response = nlohmann::json::parse(response.text);
-            std::string cmd_id = json_response["command_id"];
-            return cmd_id;
+            auto json_response = decode(response);
+            return std::to_string(json_response["command_id"].get<uint64_t>());
         }
 
         LOG_ERR("Failed to send command, status code: {}", response.status_code);
         return "";
     }
 
-    std::optional<CommandResult> Controller::get_status(const std::string& command_id) {
-        auto response = cpr::Get(cpr::Url{api_url + "/status/" + command_id});
+    std::optional<CommandResult> Controller::get_status(const std::string& command_id,
+                                                        int wait_ms) {
+        auto response =
+            request(false, "/status/" + command_id + "?wait=" + std::to_string(wait_ms));
 
         if (response.status_code == 200) {
-            auto json_response = nlohmann::json::parse(response.text);
+            auto json_response = decode(response);
 
             if (json_response["status"] != "not_found") {
                 CommandResult result;
@@ -42,8 +122,7 @@ namespace control {
     }
 
     std::optional<CommandResult> Controller::wait_for_completion(const std::string& command_id,
-                                                                 int timeout_ms,
-                                                                 int poll_interval_ms) {
+                                                                 int timeout_ms) {
         auto start = std::chrono::steady_clock::now();
 
         while (true) {
@@ -56,12 +135,15 @@ namespace control {
                 return std::nullopt;
             }
 
-            auto status = get_status(command_id);
-            if (status.has_value() && status->status != "pending") {
-                return status;
+            // the server answers as soon as the result is posted, so this is normally the only
+            // round-trip; it only loops if the long-poll itself expires
+            auto status = get_status(command_id, static_cast<int>(timeout_ms - elapsed));
+            if (!status.has_value()) {
+                LOG_ERR("Lost track of command {}", command_id);
+                return std::nullopt;
             }
-
-            std::this_thread::sleep_for(std::chrono::milliseconds(poll_interval_ms));
+            if (status->status != "pending")
+                return status;
         }
     }
 
@@ -73,6 +155,161 @@ namespace control {
         return result.has_value() && result->status == "completed";
     }
 
+    std::optional<std::vector<CommandResult>>
+    Controller::execute_batch(const std::vector<BatchCommand>& commands, int timeout_ms) {
+        nlohmann::json payload = {{"commands", nlohmann::json::array()}};
+        for (const auto& cmd : commands)
+            payload["commands"].push_back({{"action", cmd.action}, {"data", cmd.data}});
+
+        LOG_INFO("Sending batch of {} commands", commands.size());
+
+        auto response = request(true, "/execute_batch", payload);
+        if (response.status_code != 200) {
+            LOG_ERR("Failed to send batch, status code: {}", response.status_code);
+            return std::nullopt;
+        }
+
+        std::string command_id = std::to_string(decode(response)["command_id"].get<uint64_t>());
+        auto result = wait_for_completion(command_id, timeout_ms);
+        if (!result.has_value())
+            return std::nullopt;
+
+        try {
+            std::vector<CommandResult> results;
+            for (const auto& entry : result->result.at("results")) {
+                results.push_back({entry.at("status").get<std::string>(),
+                                   entry.value("result", nlohmann::json())});
+            }
+            if (results.size() != commands.size()) {
+                LOG_ERR("Batch {} returned {} results for {} commands", command_id,
+                        results.size(), commands.size());
+                return std::nullopt;
+            }
+            return results;
+        } catch (const std::exception& e) {
+            LOG_ERR("Malformed batch result for {}: {}", command_id, e.what());
+            return std::nullopt;
+        }
+    }
+
+    AsyncResult Controller::execute_async(const std::string& action, const nlohmann::json& data,
+                                          CompletionCallback on_complete, int timeout_ms) {
+        AsyncCommand command;
+        command.command_id = send_command(action, data);
+        command.deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        command.on_complete = std::move(on_complete);
+        AsyncResult future = command.promise.get_future().share();
+
+        if (command.command_id.empty()) {
+            complete(command, std::nullopt);
+            return future;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(async_mutex);
+            if (!io_stop) {
+                if (!io_thread.joinable())
+                    io_thread = std::thread([this] { io_loop(); });
+                async_submitted.push_back(std::move(command));
+                async_cv.notify_one();
+                return future;
+            }
+        }
+
+        // the controller is being destroyed, nobody is left to wait for the result
+        complete(command, std::nullopt);
+        return future;
+    }
+
+    bool Controller::wait_all(const std::vector<AsyncResult>& pending) {
+        bool ok = true;
+        for (const auto& future : pending) {
+            const auto& result = future.get();
+            ok = ok && result.has_value() && result->status == "completed";
+        }
+        return ok;
+    }
+
+    void Controller::complete(AsyncCommand& command, const std::optional<CommandResult>& result) {
+        if (command.on_complete) {
+            try {
+                command.on_complete(result);
+            } catch (const std::exception& e) {
+                LOG_ERR("Completion callback for command {} threw: {}", command.command_id,
+                        e.what());
+            }
+        }
+        command.promise.set_value(result);
+    }
+
+    void Controller::io_loop() {
+        std::vector<AsyncCommand> in_flight;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(async_mutex);
+                async_cv.wait(lock, [&] {
+                    return io_stop || !async_submitted.empty() || !in_flight.empty();
+                });
+                for (auto& command : async_submitted)
+                    in_flight.push_back(std::move(command));
+                async_submitted.clear();
+                if (io_stop)
+                    break;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            auto nearest = in_flight.front().deadline;
+            std::string ids;
+            for (const auto& command : in_flight) {
+                nearest = (std::min)(nearest, command.deadline);
+                ids += (ids.empty() ? "" : ",") + command.command_id;
+            }
+            auto wait_ms = std::clamp<long long>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(nearest - now).count(), 0,
+                ASYNC_POLL_MS);
+
+            auto response =
+                request(false, "/status?ids=" + ids + "&wait=" + std::to_string(wait_ms));
+            nlohmann::json results;
+            if (response.status_code == 200) {
+                try {
+                    results = decode(response).at("results");
+                } catch (const std::exception& e) {
+                    LOG_ERR("Malformed status response: {}", e.what());
+                }
+            } else {
+                // server unreachable: back off rather than spin until the deadlines pass
+                std::unique_lock<std::mutex> lock(async_mutex);
+                async_cv.wait_for(lock, std::chrono::milliseconds(ASYNC_POLL_MS),
+                                  [&] { return io_stop; });
+            }
+
+            now = std::chrono::steady_clock::now();
+            std::vector<AsyncCommand> still_pending;
+            for (auto& command : in_flight) {
+                auto entry = results.find(command.command_id);
+                if (entry != results.end() && entry->value("status", "") == "not_found") {
+                    LOG_ERR("Lost track of command {}", command.command_id);
+                    complete(command, std::nullopt);
+                } else if (entry != results.end()) {
+                    complete(command, CommandResult{entry->value("status", ""),
+                                                    entry->value("result", nlohmann::json())});
+                } else if (now >= command.deadline) {
+                    LOG_ERR("Command {} timed out", command.command_id);
+                    complete(command, std::nullopt);
+                } else {
+                    still_pending.push_back(std::move(command));
+                }
+            }
+            in_flight = std::move(still_pending);
+        }
+
+        for (auto& command : in_flight)
+            complete(command, std::nullopt);
+    }
+
     bool Controller::set_gravity(float value) {
         return execute_command("set_gravity", {{"value", value}});
     }
@@ -223,10 +460,36 @@ namespace control {
         }
     }
 
-    void Controller::set_api_url(const std::string& url) { this->api_url = url; }
+    void Controller::set_api_url(const std::string& url) {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->api_url = url;
+        // pooled connections point at the old server
+        idle_sessions.clear();
+    }
+
+    void Controller::set_encoding(protocol::Encoding encoding) {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->encoding = encoding;
+    }
 
     bool Controller::clear_queue() {
-        auto response = cpr::Post(cpr::Url{api_url + "/clear"});
+        auto response = request(true, "/clear");
         return response.status_code == 200;
     }
+
+    Controller::Metrics Controller::metrics() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+    void Controller::log_metrics() const {
+        Metrics m = metrics();
+        if (!m.requests)
+            return;
+
+        LOG_INFO("Controller: {} requests, {:.1f}% over reused connections, {} failed, "
+                 "latency {:.2f}ms mean / {:.2f}ms max",
+                 m.requests, m.reuse_rate() * 100.0, m.failed_requests, m.mean_latency_ms(),
+                 m.max_latency_ms);
+    }
 } // namespace control
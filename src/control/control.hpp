@@ -1,9 +1,22 @@
 #pragma once
+#include "control/protocol.hpp"
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <optional>
 #include <string>
 #include <thread>
+#include <vector>
+
+namespace cpr {
+    class Session;
+    class Response;
+} // namespace cpr
 
 namespace control {
     struct CommandResult {
@@ -11,15 +24,61 @@ namespace control {
         nlohmann::json result;
     };
 
+    struct BatchCommand {
+        std::string action;
+        nlohmann::json data;
+    };
+
+    // Resolves to nullopt if the command could not be sent, timed out or was lost by the server.
+    using AsyncResult = std::shared_future<std::optional<CommandResult>>;
+    using CompletionCallback = std::function<void(const std::optional<CommandResult>&)>;
+
+    // Safe to share between threads. Requests go through a pool of keep-alive cpr::Sessions, so
+    // consecutive calls reuse one TCP connection instead of opening a new one each time.
     class Controller {
       public:
+        struct Metrics {
+            uint64_t requests = 0;
+            uint64_t reused_connections = 0;
+            uint64_t failed_requests = 0;
+            double total_latency_ms = 0.0;
+            double max_latency_ms = 0.0;
+
+            double reuse_rate() const {
+                return requests ? double(reused_connections) / double(requests) : 0.0;
+            }
+            double mean_latency_ms() const {
+                return requests ? total_latency_ms / double(requests) : 0.0;
+            }
+        };
+
         Controller(const std::string& api_url = "http://localhost:8000");
+        ~Controller();
+
+        Controller(const Controller&) = delete;
+        Controller& operator=(const Controller&) = delete;
 
         std::string send_command(const std::string& action, const nlohmann::json& data);
-        std::optional<CommandResult> get_status(const std::string& command_id);
+        // wait_ms > 0 long-polls: the server holds the request until the command leaves
+        // "pending" or wait_ms runs out
+        std::optional<CommandResult> get_status(const std::string& command_id, int wait_ms = 0);
         std::optional<CommandResult> wait_for_completion(const std::string& command_id,
-                                                         int timeout_ms = 5000,
-                                                         int poll_interval_ms = 50);
+                                                         int timeout_ms = 5000);
+
+        // Sends every command in one request; the bridge applies them in the same frame. The
+        // results come back in the order of commands, nullopt if the batch never completed.
+        std::optional<std::vector<CommandResult>>
+        execute_batch(const std::vector<BatchCommand>& commands, int timeout_ms = 5000);
+
+        // Non-blocking execute. The command is posted from the calling thread, so the bridge sees
+        // commands in the order they were issued; waiting for the result is left to a single I/O
+        // thread that tracks every outstanding command over one long-poll. on_complete runs on
+        // that thread just before the future becomes ready, so it must not wait on other async
+        // commands itself.
+        AsyncResult execute_async(const std::string& action, const nlohmann::json& data,
+                                  CompletionCallback on_complete = {}, int timeout_ms = 5000);
+        // blocks until every result is ready; true if all of them completed successfully
+        static bool wait_all(const std::vector<AsyncResult>& pending);
 
         bool set_gravity(float value);
         bool set_skybox_orientation(float x, float y, float z);
@@ -62,10 +121,46 @@ namespace control {
         bool request_client_gui_info(const std::string& frame_name = "hello");
 
         void set_api_url(const std::string& url);
+        // MessagePack by default; JSON talks to servers that predate it
+        void set_encoding(protocol::Encoding encoding);
         bool clear_queue();
 
+        Metrics metrics() const;
+        void log_metrics() const;
+
       private:
+        // idle sessions kept around for reuse; more than this only happens with many threads
+        static constexpr size_t MAX_IDLE_SESSIONS = 8;
+        // cap on one multi-status long-poll, so commands issued while it is parked join the next
+        static constexpr int ASYNC_POLL_MS = 50;
+
+        struct AsyncCommand {
+            std::string command_id;
+            std::chrono::steady_clock::time_point deadline;
+            std::promise<std::optional<CommandResult>> promise;
+            CompletionCallback on_complete;
+        };
+
+        mutable std::mutex mutex;
         std::string api_url;
+        protocol::Encoding encoding = protocol::Encoding::MsgPack;
+        std::vector<std::unique_ptr<cpr::Session>> idle_sessions;
+        Metrics stats;
+
+        std::mutex async_mutex;
+        std::condition_variable async_cv;
+        std::vector<AsyncCommand> async_submitted;
+        std::thread io_thread;
+        bool io_stop = false;
+
+        cpr::Response request(bool post, const std::string& path,
+                              const nlohmann::json& body = nullptr);
+        static nlohmann::json decode(cpr::Response& response);
         bool execute_command(const std::string& action, const nlohmann::json& data);
+        void io_loop();
+        static void complete(AsyncCommand& command, const std::optional<CommandResult>& result);
     };
+
+    // The controller every phase talks through, so they all share one connection pool.
+    Controller& shared_controller();
 } // namespace control
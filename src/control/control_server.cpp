@@ -1,8 +1,10 @@
 #include "control_server.hpp"
 #include "utils/logger.hpp"
+#include <algorithm>
 #include <iomanip>
-#include <random>
+#include <iterator>
 #include <sstream>
+#include <stdexcept>
 
 namespace control {
 
@@ -14,132 +16,359 @@ namespace control {
         return ss.str();
     }
 
-    std::string ControlServer::generate_uuid() {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_int_distribution<> dis(0, 15);
-        static std::uniform_int_distribution<> dis2(8, 11);
+    void ResultTable::insert(uint64_t id, const StoredResult& result) {
+        Slot& slot = slots[id % CAPACITY];
+        std::lock_guard<std::mutex> lock(slot.mutex);
+        slot.id = id;
+        slot.result = result;
+        slot.expires = std::chrono::steady_clock::now() + TTL;
+    }
 
-        std::stringstream ss;
-        ss << std::hex;
-        for (int i = 0; i < 8; i++)
-            ss << dis(gen);
-        ss << "-";
-        for (int i = 0; i < 4; i++)
-            ss << dis(gen);
-        ss << "-4";
-        for (int i = 0; i < 3; i++)
-            ss << dis(gen);
-        ss << "-";
-        ss << dis2(gen);
-        for (int i = 0; i < 3; i++)
-            ss << dis(gen);
-        ss << "-";
-        for (int i = 0; i < 12; i++)
-            ss << dis(gen);
-        return ss.str();
+    bool ResultTable::update(uint64_t id, const StoredResult& result) {
+        Slot& slot = slots[id % CAPACITY];
+        std::lock_guard<std::mutex> lock(slot.mutex);
+        if (slot.id != id || std::chrono::steady_clock::now() >= slot.expires)
+            return false;
+        slot.result = result;
+        slot.expires = std::chrono::steady_clock::now() + TTL;
+        return true;
+    }
+
+    std::optional<StoredResult> ResultTable::find(uint64_t id) {
+        Slot& slot = slots[id % CAPACITY];
+        std::lock_guard<std::mutex> lock(slot.mutex);
+        if (slot.id != id || std::chrono::steady_clock::now() >= slot.expires)
+            return std::nullopt;
+        return slot.result;
+    }
+
+    std::chrono::milliseconds ControlServer::long_poll_wait(const httplib::Request& req) {
+        if (!req.has_param("wait"))
+            return std::chrono::milliseconds(0);
+
+        try {
+            int wait_ms = std::stoi(req.get_param_value("wait"));
+            return std::chrono::milliseconds(std::clamp(wait_ms, 0, MAX_LONG_POLL_MS));
+        } catch (const std::exception&) {
+            return std::chrono::milliseconds(0);
+        }
+    }
+
+    uint64_t ControlServer::enqueue(const std::string& action, const nlohmann::json& data) {
+        CommandData cmd;
+        cmd.id = next_command_id.fetch_add(1, std::memory_order_relaxed);
+        cmd.action = action;
+        cmd.data = data;
+        cmd.json = protocol::to_full(cmd.id, action, data).dump();
+        auto compact = protocol::to_compact(cmd.id, action, data);
+        cmd.compact_json = compact ? compact->dump() : cmd.json;
+
+        // the result entry has to exist before the bridge can see the command, otherwise a fast
+        // /result could arrive for an id the server does not know yet
+        command_results.insert(cmd.id, {"pending", nullptr, get_timestamp()});
+
+        uint64_t id = cmd.id;
+        queue_size.fetch_add(1);
+        command_queue.push(std::move(cmd));
+        wake(consume_mutex, queue_cv, queue_waiters);
+
+        return id;
+    }
+
+    std::vector<CommandData> ControlServer::take_commands(std::chrono::milliseconds wait) {
+        std::vector<CommandData> commands;
+        std::unique_lock<std::mutex> lock(consume_mutex);
+        queue_waiters++;
+        std::atomic_thread_fence(std::memory_order_seq_cst); // pairs with wake()
+        queue_cv.wait_for(lock, wait, [this] {
+            return !requeued.empty() || !command_queue.empty() || !running;
+        });
+        queue_waiters--;
+
+        for (auto& cmd : requeued) {
+            queue_size.fetch_sub(1);
+            commands.push_back(std::move(cmd));
+        }
+        requeued.clear();
+        while (auto cmd = command_queue.pop()) {
+            queue_size.fetch_sub(1);
+            commands.push_back(std::move(*cmd));
+        }
+        return commands;
+    }
+
+    void ControlServer::requeue_front(std::vector<CommandData> commands) {
+        {
+            std::lock_guard<std::mutex> lock(consume_mutex);
+            queue_size.fetch_add(commands.size());
+            requeued.insert(requeued.begin(), std::make_move_iterator(commands.begin()),
+                            std::make_move_iterator(commands.end()));
+        }
+        wake(consume_mutex, queue_cv, queue_waiters);
+    }
+
+    protocol::Encoding ControlServer::request_encoding(const httplib::Request& req) {
+        return protocol::encoding_from_header(req.get_header_value("Content-Type"));
+    }
+
+    // Responses follow the Accept header, so each client picks its own encoding.
+    void ControlServer::respond(const httplib::Request& req, httplib::Response& res,
+                                const nlohmann::json& message) {
+        auto encoding = protocol::encoding_from_header(req.get_header_value("Accept"));
+        res.set_content(protocol::encode(message, encoding),
+                        std::string(protocol::content_type(encoding)));
+    }
+
+    bool ControlServer::wants_compact(const httplib::Request& req) {
+        return req.has_param("schema") && req.get_param_value("schema") == "compact";
+    }
+
+    // Ids go out as JSON numbers; the decimal string form is accepted too.
+    std::optional<uint64_t> ControlServer::parse_command_id(const nlohmann::json& value) {
+        try {
+            if (value.is_number_integer())
+                return value.get<uint64_t>();
+            // Luau numbers are doubles, so the bridge may echo 12 as 12.0
+            if (value.is_number_float())
+                return static_cast<uint64_t>(value.get<double>());
+            if (value.is_string())
+                return std::stoull(value.get<std::string>());
+        } catch (const std::exception&) {
+        }
+        return std::nullopt;
+    }
+
+    // A waiter increments its counter under the mutex, then fences, then checks for work; the
+    // producer publishes its work, fences, then reads the counter. The paired seq_cst fences stop
+    // either side's store from passing its later load, so either the waiter sees the work or the
+    // producer sees the waiter, and the empty lock below orders the notify after its wait.
+    void ControlServer::wake(std::mutex& mutex, std::condition_variable& cv,
+                             const std::atomic<int>& waiters) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load() == 0)
+            return;
+        { std::lock_guard<std::mutex> lock(mutex); }
+        cv.notify_all();
     }
 
     void ControlServer::setup_routes() {
         server->Post("/execute", [this](const httplib::Request& req, httplib::Response& res) {
             try {
-                auto json_body = nlohmann::json::parse(req.body);
-                std::string command_id = generate_uuid();
+                auto json_body = protocol::decode(req.body, request_encoding(req));
+                uint64_t command_id = enqueue(json_body["action"], json_body["data"]);
+
+                nlohmann::json response = {{"command_id", command_id}, {"status", "queued"}};
+                respond(req, res, response);
+            } catch (const std::exception& e) {
+                res.status = 400;
+                nlohmann::json error = {{"error", e.what()}};
+                respond(req, res, error);
+            }
+        });
 
-                CommandData cmd;
-                cmd.id = command_id;
-                cmd.action = json_body["action"];
-                cmd.data = json_body["data"];
+        // The whole batch travels as one "batch" command, so the bridge receives it in a single
+        // /poll response and applies every entry in the same frame. Its result is an array with
+        // one {status, result} per entry, in request order.
+        server->Post("/execute_batch", [this](const httplib::Request& req,
+                                              httplib::Response& res) {
+            try {
+                auto json_body = protocol::decode(req.body, request_encoding(req));
+                const auto& commands = json_body.at("commands");
+                if (!commands.is_array() || commands.empty())
+                    throw std::invalid_argument("'commands' must be a non-empty array");
 
-                {
-                    std::lock_guard<std::mutex> lock(queue_mutex);
-                    command_queue.push_back(cmd);
+                nlohmann::json batch = nlohmann::json::array();
+                for (const auto& cmd : commands) {
+                    batch.push_back({{"action", cmd.at("action").get<std::string>()},
+                                     {"data", cmd.value("data", nlohmann::json::object())}});
                 }
 
-                {
-                    std::lock_guard<std::mutex> lock(results_mutex);
-                    command_results[command_id] = {"pending", nullptr, get_timestamp()};
-                }
+                uint64_t command_id = enqueue("batch", {{"commands", batch}});
 
-                nlohmann::json response = {{"command_id", command_id}, {"status", "queued"}};
-                res.set_content(response.dump(), "application/json");
+                nlohmann::json response = {
+                    {"command_id", command_id}, {"status", "queued"}, {"count", batch.size()}};
+                respond(req, res, response);
             } catch (const std::exception& e) {
                 res.status = 400;
                 nlohmann::json error = {{"error", e.what()}};
-                res.set_content(error.dump(), "application/json");
+                respond(req, res, error);
             }
         });
 
-        server->Get("/poll", [this](const httplib::Request&, httplib::Response& res) {
-            nlohmann::json response;
-            std::lock_guard<std::mutex> lock(queue_mutex);
+        server->Get("/poll", [this](const httplib::Request& req, httplib::Response& res) {
+            auto commands = take_commands(long_poll_wait(req));
+            bool compact = wants_compact(req);
 
-            if (!command_queue.empty()) {
-                nlohmann::json commands = nlohmann::json::array();
-                for (const auto& cmd : command_queue) {
-                    commands.push_back(
-                        {{"id", cmd.id}, {"action", cmd.action}, {"data", cmd.data}});
+            auto encoding = protocol::encoding_from_header(req.get_header_value("Accept"));
+            if (encoding == protocol::Encoding::Json) {
+                // splice the pre-encoded commands instead of building and dumping a document
+                std::string body = R"({"commands":[)";
+                for (size_t i = 0; i < commands.size(); i++) {
+                    if (i)
+                        body += ',';
+                    body += compact ? commands[i].compact_json : commands[i].json;
                 }
-                command_queue.clear();
-                response["commands"] = commands;
-            } else {
-                response["commands"] = nlohmann::json::array();
+                body += "]}";
+                res.set_content(body, std::string(protocol::JSON_CONTENT_TYPE));
+                return;
+            }
+
+            nlohmann::json entries = nlohmann::json::array();
+            for (const auto& cmd : commands) {
+                auto entry = compact ? protocol::to_compact(cmd.id, cmd.action, cmd.data)
+                                     : std::nullopt;
+                entries.push_back(entry ? *entry
+                                        : protocol::to_full(cmd.id, cmd.action, cmd.data));
             }
+            respond(req, res, {{"commands", entries}});
+        });
+
+        // Push channel: one long-lived response that writes every command as an NDJSON line the
+        // moment it is queued. Results still come back through /result, and /poll keeps working
+        // for bridges that cannot hold a stream open; both drain the same queue. Lines are always
+        // JSON; ?schema=compact applies as for /poll.
+        server->Get("/stream", [this](const httplib::Request& req, httplib::Response& res) {
+            stream_clients++;
+            bool compact = wants_compact(req);
+            res.set_header("Cache-Control", "no-cache");
+            res.set_chunked_content_provider(
+                "application/x-ndjson",
+                [this, compact](size_t, httplib::DataSink& sink) {
+                    auto commands = take_commands(std::chrono::milliseconds(STREAM_HEARTBEAT_MS));
+                    if (!running) {
+                        sink.done();
+                        return false;
+                    }
 
-            res.set_content(response.dump(), "application/json");
+                    std::string lines;
+                    for (const auto& cmd : commands)
+                        lines += (compact ? cmd.compact_json : cmd.json) + "\n";
+                    if (commands.empty())
+                        lines = R"({"heartbeat":true})" "\n";
+
+                    if (!sink.write(lines.data(), lines.size())) {
+                        // the client went away; hand the commands to whoever polls next, in
+                        // their original order. Part of the write may already have reached the
+                        // bridge, which skips command ids it has already run.
+                        requeue_front(std::move(commands));
+                        return false;
+                    }
+                    return true;
+                },
+                [this](bool) { stream_clients--; });
         });
 
         server->Post("/result", [this](const httplib::Request& req, httplib::Response& res) {
             try {
-                auto json_body = nlohmann::json::parse(req.body);
-                std::string command_id = json_body["command_id"];
+                auto json_body = protocol::decode(req.body, request_encoding(req));
+                auto command_id = parse_command_id(json_body["command_id"]);
 
-                std::lock_guard<std::mutex> lock(results_mutex);
-                if (command_results.find(command_id) != command_results.end()) {
-                    command_results[command_id] = {json_body["status"], json_body["result"],
-                                                   json_body["timestamp"]};
+                if (command_id && command_results.update(*command_id, {json_body["status"],
+                                                                       json_body["result"],
+                                                                       json_body["timestamp"]})) {
+                    wake(results_mutex, results_cv, results_waiters);
                     nlohmann::json response = {{"status", "ok"}};
-                    res.set_content(response.dump(), "application/json");
+                    respond(req, res, response);
                 } else {
                     res.status = 404;
                     nlohmann::json error = {{"status", "error"},
                                             {"message", "command_id not found"}};
-                    res.set_content(error.dump(), "application/json");
+                    respond(req, res, error);
                 }
             } catch (const std::exception& e) {
                 res.status = 400;
                 nlohmann::json error = {{"error", e.what()}};
-                res.set_content(error.dump(), "application/json");
+                respond(req, res, error);
             }
         });
 
-        server->Get("/status/(.*)", [this](const httplib::Request& req, httplib::Response& res) {
-            std::string command_id = req.matches[1];
-            std::lock_guard<std::mutex> lock(results_mutex);
+        server->Get(R"(/status/(\d+))", [this](const httplib::Request& req,
+                                               httplib::Response& res) {
+            uint64_t command_id = std::stoull(req.matches[1]);
+
+            std::optional<StoredResult> result;
+            {
+                std::unique_lock<std::mutex> lock(results_mutex);
+                results_waiters++;
+                std::atomic_thread_fence(std::memory_order_seq_cst); // pairs with wake()
+                results_cv.wait_for(lock, long_poll_wait(req), [&] {
+                    result = command_results.find(command_id);
+                    return !result || result->status != "pending" || !running;
+                });
+                results_waiters--;
+            }
 
-            if (command_results.find(command_id) != command_results.end()) {
-                auto& result = command_results[command_id];
-                nlohmann::json response = {{"status", result.status},
-                                           {"result", result.result},
-                                           {"timestamp", result.timestamp}};
-                res.set_content(response.dump(), "application/json");
+            if (result) {
+                nlohmann::json response = {{"status", result->status},
+                                           {"result", result->result},
+                                           {"timestamp", result->timestamp}};
+                respond(req, res, response);
             } else {
                 nlohmann::json response = {{"status", "not_found"}};
-                res.set_content(response.dump(), "application/json");
+                respond(req, res, response);
+            }
+        });
+
+        // /status?ids=1,2,3&wait=<ms> is the same for several commands at once: it returns as soon
+        // as any of them has left "pending" (or wait runs out) with an entry for each of those,
+        // so one client can track many commands over a single parked request.
+        server->Get("/status", [this](const httplib::Request& req, httplib::Response& res) {
+            std::vector<uint64_t> ids;
+            std::stringstream list(req.get_param_value("ids"));
+            std::string id;
+            while (std::getline(list, id, ',')) {
+                try {
+                    ids.push_back(std::stoull(id));
+                } catch (const std::exception&) {
+                    res.status = 400;
+                    respond(req, res, {{"error", "invalid id: " + id}});
+                    return;
+                }
+            }
+
+            nlohmann::json results = nlohmann::json::object();
+            auto collect = [&] {
+                for (uint64_t command_id : ids) {
+                    auto result = command_results.find(command_id);
+                    if (!result) {
+                        results[std::to_string(command_id)] = {{"status", "not_found"}};
+                    } else if (result->status != "pending") {
+                        results[std::to_string(command_id)] = {{"status", result->status},
+                                                               {"result", result->result},
+                                                               {"timestamp", result->timestamp}};
+                    }
+                }
+                return !results.empty() || !running;
+            };
+
+            if (!ids.empty()) {
+                std::unique_lock<std::mutex> lock(results_mutex);
+                results_waiters++;
+                std::atomic_thread_fence(std::memory_order_seq_cst); // pairs with wake()
+                results_cv.wait_for(lock, long_poll_wait(req), collect);
+                results_waiters--;
             }
+
+            respond(req, res, {{"results", results}});
         });
 
-        server->Post("/clear", [this](const httplib::Request&, httplib::Response& res) {
-            std::lock_guard<std::mutex> lock(queue_mutex);
-            command_queue.clear();
+        server->Post("/clear", [this](const httplib::Request& req, httplib::Response& res) {
+            {
+                std::lock_guard<std::mutex> lock(consume_mutex);
+                queue_size.fetch_sub(requeued.size());
+                requeued.clear();
+                while (command_queue.pop())
+                    queue_size.fetch_sub(1);
+            }
             nlohmann::json response = {{"status", "cleared"}};
-            res.set_content(response.dump(), "application/json");
+            respond(req, res, response);
         });
 
-        server->Get("/", [this](const httplib::Request&, httplib::Response& res) {
-            std::lock_guard<std::mutex> lock(queue_mutex);
-            nlohmann::json response = {{"status", "running"}, {"queue_size", command_queue.size()}};
-            res.set_content(response.dump(), "application/json");
+        server->Get("/", [this](const httplib::Request& req, httplib::Response& res) {
+            nlohmann::json response = {{"status", "running"},
+                                       {"queue_size", queue_size.load()},
+                                       {"stream_clients", stream_clients.load()}};
+            respond(req, res, response);
         });
     }
 
@@ -170,7 +399,13 @@ namespace control {
         if (!running)
             return;
 
-        running = false;
+        {
+            std::scoped_lock lock(consume_mutex, results_mutex);
+            running = false;
+        }
+        // release parked long-polls so the listener threads can be joined
+        queue_cv.notify_all();
+        results_cv.notify_all();
         server->stop();
         if (server_thread.joinable()) {
             server_thread.join();
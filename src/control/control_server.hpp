@@ -1,44 +1,114 @@
 #pragma once
+#include "control/protocol.hpp"
+#include "utils/mpsc_queue.hpp"
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <httplib.h>
-#include <map>
 #include <memory>
 #include <mutex>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace control {
 
     struct CommandData {
-        std::string id;
+        uint64_t id;
         std::string action;
         nlohmann::json data;
+        // the command serialized once at enqueue, in the full and the compact schema, so /poll
+        // and /stream only concatenate
+        std::string json;
+        std::string compact_json;
     };
 
-    struct CommandResult {
+    struct StoredResult {
         std::string status; // "pending", "completed", "failed"
         nlohmann::json result;
         std::string timestamp;
     };
 
+    // Results by command id in a fixed ring of slots: id % CAPACITY picks the slot, so a command
+    // is evicted once CAPACITY newer ones were issued or TTL after it was last touched, whichever
+    // comes first. Memory stays constant however long the server runs, and each slot has its own
+    // lock so unrelated commands never contend.
+    class ResultTable {
+      public:
+        static constexpr size_t CAPACITY = 1024;
+        static constexpr std::chrono::minutes TTL{5};
+
+        void insert(uint64_t id, const StoredResult& result);
+        // false if id was evicted or never issued
+        bool update(uint64_t id, const StoredResult& result);
+        std::optional<StoredResult> find(uint64_t id);
+
+      private:
+        struct Slot {
+            std::mutex mutex;
+            uint64_t id = 0;
+            StoredResult result;
+            std::chrono::steady_clock::time_point expires;
+        };
+
+        std::array<Slot, CAPACITY> slots;
+    };
+
+    // upper bound for a single long-poll; clients simply issue the next one when it expires
+    inline constexpr int MAX_LONG_POLL_MS = 25000;
+    // an idle /stream sends a heartbeat line this often, which is also how a dropped client is
+    // noticed
+    inline constexpr int STREAM_HEARTBEAT_MS = 5000;
+
     class ControlServer {
       private:
         std::unique_ptr<httplib::Server> server;
         std::thread server_thread;
         std::atomic<bool> running{false};
 
-        std::deque<CommandData> command_queue;
-        std::map<std::string, CommandResult> command_results;
-        std::mutex queue_mutex;
+        std::atomic<uint64_t> next_command_id{1};
+        // /execute pushes without locking; /poll and /clear are the consumers and take
+        // consume_mutex to stay one at a time
+        MpscQueue<CommandData> command_queue;
+        // commands a dropped /stream took but could not deliver; they are older than anything in
+        // command_queue, so take_commands hands them out first. Guarded by consume_mutex.
+        std::deque<CommandData> requeued;
+        std::atomic<size_t> queue_size{0};
+        ResultTable command_results;
+
+        // /poll?wait=<ms> and /status/<id>?wait=<ms> park on these until there is something to
+        // return, instead of the caller re-polling on an interval. Producers only take the mutex
+        // when somebody is actually parked.
+        std::mutex consume_mutex;
         std::mutex results_mutex;
+        std::condition_variable queue_cv;
+        std::condition_variable results_cv;
+        std::atomic<int> queue_waiters{0};
+        std::atomic<int> results_waiters{0};
+        std::atomic<int> stream_clients{0};
 
         int port;
 
         std::string get_timestamp();
-        std::string generate_uuid();
+        static std::chrono::milliseconds long_poll_wait(const httplib::Request& req);
+        uint64_t enqueue(const std::string& action, const nlohmann::json& data);
+        // waits up to wait for at least one command, then drains the queue
+        std::vector<CommandData> take_commands(std::chrono::milliseconds wait);
+        // puts undelivered commands back at the head of the queue, ahead of newer ones
+        void requeue_front(std::vector<CommandData> commands);
+
+        static protocol::Encoding request_encoding(const httplib::Request& req);
+        static void respond(const httplib::Request& req, httplib::Response& res,
+                            const nlohmann::json& message);
+        static bool wants_compact(const httplib::Request& req);
+        static std::optional<uint64_t> parse_command_id(const nlohmann::json& value);
+        static void wake(std::mutex& mutex, std::condition_variable& cv,
+                         const std::atomic<int>& waiters);
 
         void setup_routes();
 
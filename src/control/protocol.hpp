@@ -0,0 +1,130 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Wire format shared by ControlServer and Controller.
+//
+// Every message is a JSON document. A client may ask for it MessagePack-encoded instead (via
+// nlohmann's built-in support) by sending its body with Content-Type application/msgpack and/or
+// asking for responses with Accept: application/msgpack. Everything else gets plain JSON, so the
+// Lua bridge is unaffected unless it opts in.
+//
+// Independently, /poll and /stream take ?schema=compact. Commands listed in COMMAND_SCHEMAS then
+// go out as a positional array [id, opcode, field...] instead of {id, action, data}, which is
+// what the interactive phases send almost exclusively.
+namespace control::protocol {
+
+    enum class Encoding { Json, MsgPack };
+
+    inline constexpr std::string_view JSON_CONTENT_TYPE = "application/json";
+    inline constexpr std::string_view MSGPACK_CONTENT_TYPE = "application/msgpack";
+
+    inline Encoding encoding_from_header(std::string_view value) {
+        return value.find("msgpack") != std::string_view::npos ? Encoding::MsgPack
+                                                               : Encoding::Json;
+    }
+
+    inline std::string_view content_type(Encoding encoding) {
+        return encoding == Encoding::MsgPack ? MSGPACK_CONTENT_TYPE : JSON_CONTENT_TYPE;
+    }
+
+    inline std::string encode(const nlohmann::json& message, Encoding encoding) {
+        if (encoding == Encoding::Json)
+            return message.dump();
+        auto bytes = nlohmann::json::to_msgpack(message);
+        return std::string(bytes.begin(), bytes.end());
+    }
+
+    // throws nlohmann::json::parse_error on malformed input, like nlohmann::json::parse
+    inline nlohmann::json decode(const std::string& body, Encoding encoding) {
+        if (encoding == Encoding::Json)
+            return nlohmann::json::parse(body);
+        return nlohmann::json::from_msgpack(body);
+    }
+
+    struct CommandSchema {
+        std::string_view action;
+        std::array<std::string_view, 4> fields;
+        size_t field_count;
+    };
+
+    // The opcode is the index + 1. Append only: RemoteController.lua keeps a copy of this table.
+    inline constexpr std::array<CommandSchema, 22> COMMAND_SCHEMAS = {{
+        {"set_gravity", {"value"}, 1},
+        {"set_camera_fov", {"value"}, 1},
+        {"set_camera_position", {"x", "y", "z"}, 3},
+        {"set_camera_rotation", {"x", "y", "z"}, 3},
+        {"set_skybox_orientation", {"x", "y", "z"}, 3},
+        {"set_frame_position", {"x_scale", "x_offset", "y_scale", "y_offset"}, 4},
+        {"set_frame_size", {"x_scale", "x_offset", "y_scale", "y_offset"}, 4},
+        {"set_frame_visible", {"value"}, 1},
+        {"set_tool_grip_pos", {"x", "y", "z"}, 3},
+        {"set_tool_can_be_dropped", {"value"}, 1},
+        {"set_tool_enabled", {"value"}, 1},
+        {"set_tool_manual_activation", {"value"}, 1},
+        {"set_tool_requires_handle", {"value"}, 1},
+        {"set_highlight_depth_mode", {"value"}, 1},
+        {"set_proximity_prompt_enabled", {"value"}, 1},
+        {"set_proximity_prompt_requires_line_of_sight", {"value"}, 1},
+        {"set_npc_auto_rotate", {"value"}, 1},
+        {"set_npc_auto_jump_enabled", {"value"}, 1},
+        {"set_npc_break_joints_on_death", {"value"}, 1},
+        {"set_npc_requires_neck", {"value"}, 1},
+        {"set_npc_use_jump_power", {"value"}, 1},
+        {"set_npc_move_direction", {"x", "y", "z"}, 3},
+    }};
+
+    inline nlohmann::json to_full(uint64_t id, const std::string& action,
+                                  const nlohmann::json& data) {
+        return {{"id", id}, {"action", action}, {"data", data}};
+    }
+
+    // [id, opcode, field...] when the command matches a schema exactly (same fields, all numbers
+    // or bools), otherwise nullopt and the caller sends the full form.
+    inline std::optional<nlohmann::json> to_compact(uint64_t id, const std::string& action,
+                                                    const nlohmann::json& data) {
+        for (size_t i = 0; i < COMMAND_SCHEMAS.size(); i++) {
+            const auto& schema = COMMAND_SCHEMAS[i];
+            if (schema.action != action)
+                continue;
+            if (!data.is_object() || data.size() != schema.field_count)
+                return std::nullopt;
+
+            nlohmann::json compact = nlohmann::json::array({id, i + 1});
+            for (size_t f = 0; f < schema.field_count; f++) {
+                auto it = data.find(schema.fields[f]);
+                if (it == data.end() || !(it->is_number() || it->is_boolean()))
+                    return std::nullopt;
+                compact.push_back(*it);
+            }
+            return compact;
+        }
+        return std::nullopt;
+    }
+
+    // Inverse of to_compact; full-form commands pass through untouched.
+    inline std::optional<nlohmann::json> expand(const nlohmann::json& command) {
+        if (command.is_object())
+            return command;
+        if (!command.is_array() || command.size() < 2 || !command[0].is_number_unsigned() ||
+            !command[1].is_number_unsigned())
+            return std::nullopt;
+
+        size_t opcode = command[1].get<size_t>();
+        if (opcode == 0 || opcode > COMMAND_SCHEMAS.size())
+            return std::nullopt;
+        const auto& schema = COMMAND_SCHEMAS[opcode - 1];
+        if (command.size() != schema.field_count + 2)
+            return std::nullopt;
+
+        nlohmann::json data = nlohmann::json::object();
+        for (size_t f = 0; f < schema.field_count; f++)
+            data[std::string(schema.fields[f])] = command[f + 2];
+        return to_full(command[0].get<uint64_t>(), std::string(schema.action), data);
+    }
+
+} // namespace control::protocol
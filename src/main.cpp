@@ -1,62 +1,170 @@
+#include "control/control.hpp"
 #include "control/control_server.hpp"
 #include "memory/memory.h"
 #include "scanner/scanner.hpp"
+#include "utils/checkpoint.hpp"
+#include "utils/cli.hpp"
 #include "utils/config.hpp"
+#include "utils/dump_cache.hpp"
+#include "utils/event_log.hpp"
 #include "utils/file_utils.hpp"
 #include "utils/logger.hpp"
+#include "utils/offset_diff.hpp"
+#include "utils/offset_file.hpp"
 #include "utils/offset_registry.hpp"
-#include <regex>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
 
-int main() {
-    if (!config::init()) {
+int main(int argc, char** argv) {
+    auto options = cli::parse(argc, argv);
+    if (!options || options->help) {
+        cli::print_usage(argv[0]);
+        return options ? cli::OK : cli::USAGE;
+    }
+
+    // interactive runs keep the console open until Enter; batch runs just exit
+    auto finish = [&](int code) {
+        if (!options->batch)
+            std::cin.get();
+        return code;
+    };
+
+    auto phase_names = scanner::phase_names();
+    for (const auto& phase : options->phases) {
+        if (std::find(phase_names.begin(), phase_names.end(), phase) == phase_names.end()) {
+            LOG_ERR("Unknown phase: {}", phase);
+            cli::print_usage(argv[0]);
+            return finish(cli::USAGE);
+        }
+    }
+
+    std::string output_dir =
+        options->output_dir.empty() ? file_utils::get_exe_directory() : options->output_dir;
+    std::error_code ec;
+    std::filesystem::create_directories(output_dir, ec);
+    if (ec) {
+        LOG_ERR("Failed to create {}: {}", output_dir, ec.message());
+        return finish(cli::OUTPUT);
+    }
+
+    Logger::set_file(output_dir + "\\dumper.log");
+    event_log::writer.open(output_dir + "\\events.bin");
+
+    // --diff: two or more dumps are diffed against each other without attaching to Roblox, a
+    // single one is loaded now and diffed against this run's dump once it is written
+    std::string diff_path = output_dir + "\\offsets_diff.json";
+    std::optional<offset_diff::Source> diff_base;
+    if (!options->diff_paths.empty()) {
+        auto sources = offset_diff::load_all(options->diff_paths);
+        if (!sources)
+            return finish(cli::INPUT);
+        if (sources->size() > 1)
+            return finish(offset_diff::run(*sources, diff_path) ? cli::OK : cli::OUTPUT);
+        if (sources->empty()) {
+            LOG_ERR("No offsets.json files found in {}", options->diff_paths.front());
+            return finish(cli::INPUT);
+        }
+        diff_base = std::move(sources->front());
+    }
+    auto diff_against_run = [&] {
+        if (!diff_base)
+            return true;
+        return offset_diff::run({*diff_base, {"this run", offset_registry.to_dump()}}, diff_path);
+    };
+
+    if (!config::init(options->config_path, !options->batch)) {
         LOG_ERR("Failed to init config");
-        std::cin.get();
-        return 1;
+        return finish(cli::CONFIG);
     }
 
-    memory = std::make_unique<Memory>("RobloxPlayerBeta.exe");
+    auto memory = std::make_unique<Memory>(options->process_name);
 
     if (!memory->process_handle) {
-        LOG_ERR("Failed to attach to Roblox");
-        std::cin.get();
-        return 1;
+        LOG_ERR("Failed to attach to {}", options->process_name);
+        return finish(cli::ATTACH);
     }
 
     LOG_SUCCESS("Attached to Roblox, PID: {}", memory->process_id);
 
+    std::string version = memory->get_roblox_version();
+    if (!version.empty()) {
+        LOG_INFO("Roblox version: {}", version);
+        offset_registry.set_roblox_version(version);
+    }
+
+    std::string output_path = output_dir + "\\offsets.hpp";
+    std::string cache_path =
+        dump_cache::path_for(file_utils::get_exe_directory() + "\\dump_cache", version);
+
+    auto cache_start = std::chrono::steady_clock::now();
+    std::optional<dump_cache::Fingerprint> fingerprint;
+    if (!version.empty())
+        fingerprint = dump_cache::fingerprint(*memory, version);
+
+    if (fingerprint && !options->no_cache) {
+        auto cached = dump_cache::load(cache_path, *fingerprint);
+        if (cached && dump_cache::spot_check(*memory, *cached)) {
+            offset_registry.restore(*cached);
+            bool written = offset_registry.write_to_file(output_path, options->formats);
+            written = diff_against_run() && written;
+
+            auto elapsed = std::chrono::duration<double, std::milli>(
+                               std::chrono::steady_clock::now() - cache_start)
+                               .count();
+            LOG_SUCCESS("Reused cached dump for {} ({:.0f}ms)", version, elapsed);
+            LOG_SUCCESS("Offsets saved to: {}", output_path);
+
+            return finish(written ? cli::OK : cli::OUTPUT);
+        }
+    }
+
+    if (!options->seed_path.empty()) {
+        auto seed = offset_file::load(options->seed_path);
+        if (!seed) {
+            LOG_ERR("Failed to load seed offsets from {}", options->seed_path);
+            return finish(cli::INPUT);
+        }
+        offset_registry.load_seed(*seed);
+    }
+
     control::ControlServer server(8000);
     server.start();
 
     if (!server.is_running()) {
         LOG_ERR("Failed to start control server");
-        std::cin.get();
-        return 1;
+        return finish(cli::CONTROL_SERVER);
     }
 
-    if (!scanner::run_all_phases()) {
+    scanner::RunOptions run_options;
+    run_options.checkpoint_path = checkpoint::path_for(
+        file_utils::get_exe_directory() + "\\checkpoints", version, memory->process_id);
+    run_options.resume = options->resume;
+    run_options.phases = options->phases;
+
+    if (!scanner::run_all_phases(*memory, run_options)) {
         LOG_ERR("Dumping failed");
-        std::cin.get();
-        return 1;
+        LOG_INFO("Finished phases were checkpointed; rerun with --resume to continue");
+        return finish(cli::DUMP_FAILED);
     }
 
     LOG_INFO("Dumping complete");
+    offset_registry.log_seed_report();
+    control::shared_controller().log_metrics();
 
-    std::string exe_path = memory->get_executable_path();
-    if (!exe_path.empty()) {
-        std::regex version_regex(R"(version-([a-f0-9]+))");
-        std::smatch match;
-        if (std::regex_search(exe_path, match, version_regex)) {
-            std::string version = "version-" + match[1].str();
-            offset_registry.set_roblox_version(version);
-        }
-    }
+    bool written = offset_registry.write_to_file(output_path, options->formats);
+    written = diff_against_run() && written;
 
-    std::string output_path = file_utils::get_exe_directory() + "\\offsets.hpp";
-    offset_registry.write_to_file(output_path);
+    // a partial run (--phases) is not a full dump of this build, so it must not be served from
+    // the cache later
+    bool complete = options->phases.empty();
+    if (complete && fingerprint &&
+        dump_cache::store(cache_path, *fingerprint, offset_registry.to_dump())) {
+        LOG_INFO("Cached dump for {} in {}", version, cache_path);
+    }
 
     LOG_SUCCESS("Dumping Complete");
     LOG_SUCCESS("Offsets saved to: {}", output_path);
 
-    std::cin.get();
-    return 0;
+    return finish(written ? cli::OK : cli::OUTPUT);
 }
\ No newline at end of file
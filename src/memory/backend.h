@@ -0,0 +1,59 @@
+#pragma once
+#include "memory/platform.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Where Memory gets its bytes from. Every read the scanner issues ends up in exactly one call
+// to read(), which must fail (return false) rather than fault on unreadable addresses.
+class MemoryBackend {
+  public:
+    virtual ~MemoryBackend() = default;
+    virtual bool read(uintptr_t address, void* buffer, size_t size) = 0;
+};
+
+#ifdef _WIN32
+// Reads another process through NtReadVirtualMemory. This is what the live dumper uses.
+class ProcessBackend : public MemoryBackend {
+  public:
+    explicit ProcessBackend(HANDLE process_handle) : process_handle(process_handle) {}
+    bool read(uintptr_t address, void* buffer, size_t size) override;
+
+  private:
+    HANDLE process_handle;
+};
+#endif
+
+// Reads regions of this process' own address space, e.g. synthetic object images built by the
+// benchmarks. Reads that are not fully inside one registered region fail like an unmapped page.
+class LocalBackend : public MemoryBackend {
+  public:
+    void add_region(const void* base, size_t size) {
+        Region region{reinterpret_cast<uintptr_t>(base), size};
+        auto it =
+            std::upper_bound(regions.begin(), regions.end(), region,
+                             [](const Region& a, const Region& b) { return a.start < b.start; });
+        regions.insert(it, region);
+    }
+
+    bool read(uintptr_t address, void* buffer, size_t size) override {
+        auto it = std::upper_bound(regions.begin(), regions.end(), address,
+                                   [](uintptr_t addr, const Region& r) { return addr < r.start; });
+        if (it == regions.begin())
+            return false;
+        --it;
+        if (address - it->start > it->size || size > it->size - (address - it->start))
+            return false;
+        std::memcpy(buffer, reinterpret_cast<const void*>(address), size);
+        return true;
+    }
+
+  private:
+    struct Region {
+        uintptr_t start;
+        size_t size;
+    };
+    std::vector<Region> regions;
+};
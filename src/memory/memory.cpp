@@ -1,10 +1,32 @@
 #include "memory.h"
 
+#ifdef _WIN32
 NtDll::NtDll() { base_address = (uintptr_t)GetModuleHandleA("ntdll.dll"); }
 
+bool ProcessBackend::read(uintptr_t address, void* buffer, size_t size) {
+    using tNtReadVirtualMemory = NTSTATUS(NTAPI*)(HANDLE, PVOID, PVOID, SIZE_T, PSIZE_T);
+    static tNtReadVirtualMemory fn =
+        ntdll.get_exported_function<tNtReadVirtualMemory>("NtReadVirtualMemory");
+
+    SIZE_T bytes_read = 0;
+    NTSTATUS status =
+        fn(process_handle, reinterpret_cast<PVOID>(address), buffer, size, &bytes_read);
+    return NT_SUCCESS(status) && bytes_read == size;
+}
+#endif
+
+Memory::Memory(std::unique_ptr<MemoryBackend> _backend, uintptr_t _module_base) {
+    process_id = 0;
+    window_handle = nullptr;
+    process_handle = nullptr;
+    backend = std::move(_backend);
+    module_base = _module_base;
+}
+
 Memory::Memory(std::string _process_name, std::string _window_name) {
     process_id = 0;
     window_handle = nullptr;
+    process_handle = nullptr;
     process_name = _process_name;
     window_name = _window_name;
 
@@ -18,9 +40,12 @@ Memory::Memory(std::string _process_name, std::string _window_name) {
     }
 }
 
+#ifdef _WIN32
 bool Memory::attach_process(std::string process_name) {
     process_id = find_process_id(process_name);
     process_handle = nt_open_process(process_id);
+    if (process_handle)
+        backend = std::make_unique<ProcessBackend>(process_handle);
     return process_handle != 0;
 }
 
@@ -28,6 +53,8 @@ bool Memory::attach_window(std::string window_name) {
     window_handle = FindWindowA(0, window_name.c_str());
     GetWindowThreadProcessId(window_handle, &process_id);
     process_handle = nt_open_process(process_id);
+    if (process_handle)
+        backend = std::make_unique<ProcessBackend>(process_handle);
     return process_handle != 0;
 }
 
@@ -69,8 +96,15 @@ HWND Memory::get_window_handle() {
 }
 
 uintptr_t Memory::base_address() {
-    static auto base = uintptr_t(get_module_by_name(process_id, process_name).modBaseAddr);
-    return base;
+    if (module_base)
+        return module_base;
+
+    std::lock_guard<std::mutex> lock(base_mutex);
+    if (!cached_base || base_process_id != process_id) {
+        cached_base = uintptr_t(get_module_by_name(process_id, process_name).modBaseAddr);
+        base_process_id = process_id;
+    }
+    return cached_base;
 }
 
 std::pair<int, int> Memory::get_window_dimensions() {
@@ -150,31 +184,30 @@ std::string Memory::get_executable_path() {
     std::wstring wide_path(mod.szExePath);
     return std::string(wide_path.begin(), wide_path.end());
 }
+#else
+// No process attachment off Windows; these only exist so the backend-driven paths link.
+bool Memory::attach_process(std::string) { return false; }
+bool Memory::attach_window(std::string) { return false; }
+HWND Memory::get_window_handle() { return nullptr; }
+uintptr_t Memory::base_address() { return module_base; }
+std::pair<int, int> Memory::get_window_dimensions() { return {0, 0}; }
+DWORD Memory::find_process_id(std::string) { return 0; }
+HANDLE Memory::nt_open_process(DWORD) { return nullptr; }
+MODULEENTRY32W Memory::get_module_by_name(DWORD, std::string) { return {}; }
+std::string Memory::get_executable_path() { return ""; }
+#endif
 
 std::vector<uint8_t> Memory::read_bytes(uintptr_t address, size_t size) {
-    using tNtReadVirtualMemory = NTSTATUS(NTAPI*)(HANDLE, PVOID, PVOID, SIZE_T, PSIZE_T);
-    static tNtReadVirtualMemory fn =
-        ntdll.get_exported_function<tNtReadVirtualMemory>("NtReadVirtualMemory");
-
     std::vector<uint8_t> buffer(size);
-    SIZE_T bytes_read = 0;
-    NTSTATUS status =
-        fn(process_handle, reinterpret_cast<PVOID>(address), buffer.data(), size, &bytes_read);
-
-    if (!NT_SUCCESS(status) || bytes_read != size)
+    if (!read_raw(address, buffer.data(), size))
         return {};
     return buffer;
 }
 
 bool Memory::read_raw(uintptr_t address, void* buffer, size_t size) {
-    using tNtReadVirtualMemory = NTSTATUS(NTAPI*)(HANDLE, PVOID, PVOID, SIZE_T, PSIZE_T);
-    static tNtReadVirtualMemory fn =
-        ntdll.get_exported_function<tNtReadVirtualMemory>("NtReadVirtualMemory");
-
-    SIZE_T bytes_read = 0;
-    NTSTATUS status =
-        fn(process_handle, reinterpret_cast<PVOID>(address), buffer, size, &bytes_read);
-    return NT_SUCCESS(status) && bytes_read == size;
+    bool ok = backend && backend->read(address, buffer, size);
+    event_log::count_read(size, ok);
+    return ok;
 }
 
 std::string Memory::read_string(uintptr_t address, size_t max_length) {
@@ -214,7 +247,7 @@ std::string Memory::read_roblox_string(uintptr_t address) {
     return read_string(data_ptr, length);
 }
 
-std::optional<std::pair<uintptr_t, size_t>> Memory::get_section_range(const char* section_name) {
+std::optional<IMAGE_NT_HEADERS64> Memory::get_nt_headers() {
     uintptr_t base = base_address();
 
     IMAGE_DOS_HEADER dos{};
@@ -225,18 +258,38 @@ std::optional<std::pair<uintptr_t, size_t>> Memory::get_section_range(const char
     if (!read_raw(base + dos.e_lfanew, &nt, sizeof(nt)) || nt.Signature != IMAGE_NT_SIGNATURE)
         return std::nullopt;
 
-    WORD number_of_sections = nt.FileHeader.NumberOfSections;
-    WORD opt_header_size = nt.FileHeader.SizeOfOptionalHeader;
+    return nt;
+}
+
+std::vector<IMAGE_SECTION_HEADER> Memory::get_section_headers() {
+    uintptr_t base = base_address();
+
+    IMAGE_DOS_HEADER dos{};
+    if (!read_raw(base, &dos, sizeof(dos)) || dos.e_magic != IMAGE_DOS_SIGNATURE)
+        return {};
+
+    auto nt = get_nt_headers();
+    if (!nt)
+        return {};
+
+    WORD number_of_sections = nt->FileHeader.NumberOfSections;
+    WORD opt_header_size = nt->FileHeader.SizeOfOptionalHeader;
 
     uintptr_t section_header_addr =
         base + dos.e_lfanew + sizeof(DWORD) + sizeof(IMAGE_FILE_HEADER) + opt_header_size;
 
-    for (WORD i = 0; i < number_of_sections; ++i) {
-        IMAGE_SECTION_HEADER sec{};
-        if (!read_raw(section_header_addr + i * sizeof(IMAGE_SECTION_HEADER), &sec,
-                      sizeof(IMAGE_SECTION_HEADER)))
-            return std::nullopt;
+    std::vector<IMAGE_SECTION_HEADER> sections(number_of_sections);
+    if (!read_raw(section_header_addr, sections.data(),
+                  sections.size() * sizeof(IMAGE_SECTION_HEADER)))
+        return {};
+
+    return sections;
+}
+
+std::optional<std::pair<uintptr_t, size_t>> Memory::get_section_range(const char* section_name) {
+    uintptr_t base = base_address();
 
+    for (const auto& sec : get_section_headers()) {
         char name[9]{};
         std::memcpy(name, sec.Name, 8);
 
@@ -250,94 +303,127 @@ std::optional<std::pair<uintptr_t, size_t>> Memory::get_section_range(const char
     return std::nullopt;
 }
 
+std::string Memory::get_roblox_version() {
+    std::string exe_path = get_executable_path();
+    if (exe_path.empty())
+        return "";
+
+    std::regex version_regex(R"(version-([a-f0-9]+))");
+    std::smatch match;
+    if (!std::regex_search(exe_path, match, version_regex))
+        return "";
+
+    return "version-" + match[1].str();
+}
+
 std::optional<size_t> Memory::find_verified_offset_float(const std::vector<uintptr_t>& addresses,
                                                          const std::vector<float>& expected_values,
                                                          size_t max_offset, size_t alignment,
-                                                         float tolerance) {
+                                                         float tolerance,
+                                                         std::optional<size_t> hint) {
     if (addresses.size() != expected_values.size() || addresses.empty())
         return std::nullopt;
 
-    std::vector<size_t> candidates;
-    for (size_t offset = 0; offset < max_offset; offset += alignment) {
-        float value = read<float>(addresses[0] + offset);
-        if (std::abs(value - expected_values[0]) < tolerance)
-            candidates.push_back(offset);
-    }
-
-    for (size_t offset : candidates) {
-        bool all_match = true;
-        for (size_t i = 1; i < addresses.size(); i++) {
+    event_log::Find event("find_verified_offset_float", addresses.front(), max_offset, alignment,
+                          hint);
+    std::optional<size_t> result;
+    probe_offsets(0, max_offset, alignment, hint, [&](size_t offset) {
+        for (size_t i = 0; i < addresses.size(); i++) {
             float value = read<float>(addresses[i] + offset);
-            if (std::abs(value - expected_values[i]) >= tolerance) {
-                all_match = false;
-                break;
-            }
+            if (std::abs(value - expected_values[i]) >= tolerance)
+                return false;
         }
-        if (all_match)
-            return offset;
-    }
-    return std::nullopt;
+        result = offset;
+        return true;
+    });
+    event.result = result;
+    return result;
 }
 
 std::optional<RobloxStringInfo> Memory::scan_roblox_string(uintptr_t instance_address,
                                                            const std::string& expected_name,
                                                            size_t max_pointer_offset,
-                                                           size_t alignment) {
-    constexpr size_t length_offset = 0x18;
-    for (size_t ptr_offset = 0; ptr_offset < max_pointer_offset; ptr_offset += alignment) {
+                                                           size_t alignment,
+                                                           std::optional<size_t> hint) {
+    event_log::Find event("scan_roblox_string", instance_address, max_pointer_offset, alignment,
+                          hint, expected_name);
+    std::optional<RobloxStringInfo> result;
+    probe_offsets(0, max_pointer_offset, alignment, hint, [&](size_t ptr_offset) {
         uintptr_t string_obj_ptr = read<uintptr_t>(instance_address + ptr_offset);
         if (!string_obj_ptr || string_obj_ptr < 0x10000)
-            continue;
+            return false;
 
         std::string read_name = read_roblox_string(string_obj_ptr);
         if (read_name == expected_name) {
             RobloxStringInfo info;
             info.pointer_offset = ptr_offset;
-            info.length_offset = length_offset;
-            return info;
+            info.length_offset = 0x18;
+            result = info;
         }
-    }
-    return std::nullopt;
+        return result.has_value();
+    });
+    if (result)
+        event.result = result->pointer_offset;
+    return result;
 }
 
 std::optional<size_t> Memory::find_roblox_string_direct(uintptr_t base_address,
                                                         const std::string& expected_name,
-                                                        size_t max_offset, size_t alignment) {
-    for (size_t offset = 0; offset < max_offset; offset += alignment) {
+                                                        size_t max_offset, size_t alignment,
+                                                        std::optional<size_t> hint) {
+    event_log::Find event("find_roblox_string_direct", base_address, max_offset, alignment, hint,
+                          expected_name);
+    std::optional<size_t> result;
+    probe_offsets(0, max_offset, alignment, hint, [&](size_t offset) {
         uintptr_t string_address = base_address + offset;
         std::string read_name = read_roblox_string(string_address);
         if (read_name == expected_name)
-            return offset;
-    }
-    return std::nullopt;
+            result = offset;
+        return result.has_value();
+    });
+    event.result = result;
+    return result;
 }
 
 std::optional<size_t> Memory::find_string_direct(uintptr_t base_address,
                                                  const std::string& expected_string,
                                                  size_t max_offset, size_t alignment,
-                                                 size_t max_string_length) {
-    for (size_t offset = 0; offset < max_offset; offset += alignment) {
+                                                 size_t max_string_length,
+                                                 std::optional<size_t> hint) {
+    event_log::Find event("find_string_direct", base_address, max_offset, alignment, hint,
+                          expected_string);
+    std::optional<size_t> result;
+    probe_offsets(0, max_offset, alignment, hint, [&](size_t offset) {
         uintptr_t string_address = base_address + offset;
         std::string read_str = read_string(string_address, max_string_length);
         if (read_str == expected_string)
-            return offset;
-    }
-    return std::nullopt;
+            result = offset;
+        return result.has_value();
+    });
+    event.result = result;
+    return result;
 }
 
 std::optional<size_t> Memory::find_string_by_regex(uintptr_t base_address,
                                                    const std::string& regex_pattern,
                                                    size_t max_offset, size_t alignment,
-                                                   size_t max_string_length) {
+                                                   size_t max_string_length,
+                                                   std::optional<size_t> hint) {
     std::regex pattern(regex_pattern, std::regex_constants::icase);
-    for (size_t offset = 0; offset < max_offset; offset += alignment) {
+
+    event_log::Find event("find_string_by_regex", base_address, max_offset, alignment, hint,
+                          regex_pattern);
+    std::optional<size_t> result;
+    probe_offsets(0, max_offset, alignment, hint, [&](size_t offset) {
         uintptr_t string_ptr = read<uintptr_t>(base_address + offset);
         if (!string_ptr || string_ptr < 0x10000)
-            continue;
+            return false;
 
         std::string read_str = read_string(string_ptr, max_string_length);
         if (!read_str.empty() && std::regex_match(read_str, pattern))
-            return offset;
-    }
-    return std::nullopt;
+            result = offset;
+        return result.has_value();
+    });
+    event.result = result;
+    return result;
 }
\ No newline at end of file
@@ -1,16 +1,16 @@
 #pragma once
-#define NOMINMAX
-#include <future>
+#include "memory/backend.h"
+#include "memory/platform.h"
 #include "memory/rtti.h"
+#include "utils/event_log.hpp"
 #include "utils/logger.hpp"
 #include "utils/structs.h"
-#include <TlHelp32.h>
-#include <Windows.h>
 #include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <chrono>
 #include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -21,30 +21,40 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
-#include <winternl.h>
 
+#ifdef _WIN32
 typedef CLIENT_ID* PCLIENT_ID;
 
+// ntdll.dll of this process, shared by every Memory; lookups may come from any thread.
 struct NtDll {
     uintptr_t base_address;
     NtDll();
 
-    template <typename T = uintptr_t> T get_exported_function(std::string function_name) {
-        static std::unordered_map<std::string, uintptr_t> map;
-        if (map.find(function_name) == map.end())
-            map[function_name] =
-                uintptr_t(GetProcAddress((HMODULE)base_address, function_name.c_str()));
-        return reinterpret_cast<T>(map[function_name]);
+    template <typename T = uintptr_t> T get_exported_function(const std::string& function_name) {
+        std::lock_guard<std::mutex> lock(exports_mutex);
+        auto it = exports.find(function_name);
+        if (it == exports.end()) {
+            auto address = uintptr_t(GetProcAddress((HMODULE)base_address, function_name.c_str()));
+            it = exports.emplace(function_name, address).first;
+        }
+        return reinterpret_cast<T>(it->second);
     }
+
+  private:
+    std::mutex exports_mutex;
+    std::unordered_map<std::string, uintptr_t> exports;
 };
 
+inline NtDll ntdll;
+#endif
+
 struct RobloxStringInfo {
     size_t pointer_offset;
     size_t length_offset;
 };
 
-inline NtDll ntdll;
-
+// One attached process (or backend). Instances share nothing, so several can be alive and
+// scanned from different threads at the same time; scanner::Context carries the one a scan uses.
 class Memory {
   public:
     DWORD process_id;
@@ -52,9 +62,13 @@ class Memory {
     std::string process_name;
     std::string window_name;
     HANDLE process_handle;
+    std::unique_ptr<MemoryBackend> backend;
 
   public:
     Memory(std::string _process_name, std::string _window_name = "");
+    // Reads through an arbitrary backend instead of attaching to a process. module_base is what
+    // base_address() reports, i.e. where the PE image lives inside the backend's address space.
+    Memory(std::unique_ptr<MemoryBackend> _backend, uintptr_t _module_base);
 
     bool attach_process(std::string process_name);
     bool attach_window(std::string window_name);
@@ -63,90 +77,208 @@ class Memory {
     std::pair<int, int> get_window_dimensions();
 
     template <typename T = uintptr_t> T read(uintptr_t address) {
-        using tNtReadVirtualMemory = NTSTATUS(NTAPI*)(HANDLE, PVOID, PVOID, SIZE_T, PSIZE_T);
-        static tNtReadVirtualMemory nt_read =
-            ntdll.get_exported_function<tNtReadVirtualMemory>("NtReadVirtualMemory");
-
         T buffer{};
-        SIZE_T bytes_read = 0;
-        NTSTATUS status = nt_read(process_handle, reinterpret_cast<PVOID>(address), &buffer,
-                                  sizeof(T), &bytes_read);
-        if (!NT_SUCCESS(status) || bytes_read != sizeof(T))
+        bool ok = backend && backend->read(address, &buffer, sizeof(T));
+        event_log::count_read(sizeof(T), ok);
+        if (!ok)
             return T{};
         return buffer;
     }
 
+    // Every find_* primitive takes an optional hint: the offset from a previous dump (see
+    // OffsetRegistry::seed) or one derived from a neighbouring property. Without a hint the
+    // window is walked upward as before; with one it is probed nearest-first (see probe_offsets),
+    // so a property that did not move, or only moved a little, is found after a few reads.
+
     template <typename T>
     std::optional<size_t> find_value_offset(uintptr_t base_address, T expected_value,
                                             size_t max_offset = 0x1000, size_t alignment = 0x8,
                                             size_t start_offset = 0,
-                                            const std::vector<size_t>& exclude_offsets = {}) {
-        for (size_t offset = start_offset; offset < max_offset; offset += alignment) {
+                                            const std::vector<size_t>& exclude_offsets = {},
+                                            std::optional<size_t> hint = std::nullopt) {
+        event_log::Find event("find_value_offset", base_address, max_offset, alignment, hint);
+        std::optional<size_t> result;
+        probe_offsets(start_offset, max_offset, alignment, hint, [&](size_t offset) {
             if (std::find(exclude_offsets.begin(), exclude_offsets.end(), offset) !=
                 exclude_offsets.end()) {
-                continue;
+                return false;
             }
             T value = read<T>(base_address + offset);
             if (value == expected_value)
-                return offset;
-        }
-        return std::nullopt;
+                result = offset;
+            return result.has_value();
+        });
+        event.result = result;
+        return result;
     }
 
     template <typename T>
     std::optional<size_t> find_verified_offset(const std::vector<uintptr_t>& addresses,
                                                const std::vector<T>& expected_values,
-                                               size_t max_offset = 0x1000, size_t alignment = 0x8) {
+                                               size_t max_offset = 0x1000, size_t alignment = 0x8,
+                                               std::optional<size_t> hint = std::nullopt) {
         if (addresses.size() != expected_values.size() || addresses.empty())
             return std::nullopt;
 
-        std::vector<size_t> candidates;
-        for (size_t offset = 0; offset < max_offset; offset += alignment) {
-            T value = read<T>(addresses[0] + offset);
-            if (value == expected_values[0])
-                candidates.push_back(offset);
-        }
-
-        for (size_t offset : candidates) {
-            bool all_match = true;
-            for (size_t i = 1; i < addresses.size(); i++) {
+        event_log::Find event("find_verified_offset", addresses.front(), max_offset, alignment,
+                              hint);
+        std::optional<size_t> result;
+        probe_offsets(0, max_offset, alignment, hint, [&](size_t offset) {
+            for (size_t i = 0; i < addresses.size(); i++) {
                 T value = read<T>(addresses[i] + offset);
-                if (value != expected_values[i]) {
-                    all_match = false;
-                    break;
-                }
+                if (value != expected_values[i])
+                    return false;
             }
-            if (all_match)
-                return offset;
-        }
-        return std::nullopt;
+            result = offset;
+            return true;
+        });
+        event.result = result;
+        return result;
     }
 
     std::optional<size_t> find_verified_offset_float(const std::vector<uintptr_t>& addresses,
                                                      const std::vector<float>& expected_values,
                                                      size_t max_offset = 0x1000,
                                                      size_t alignment = 0x4,
-                                                     float tolerance = 0.01f);
+                                                     float tolerance = 0.01f,
+                                                     std::optional<size_t> hint = std::nullopt);
+
+    // Polls addresses until one of them holds a value pred accepts, or timeout_ms passes. The
+    // first read is immediate, after that the interval doubles from 1ms up to about a frame, so
+    // a change the game already applied costs one read and a slow one costs at most a frame
+    // extra. Returns the address that matched.
+    template <typename T, typename Pred>
+    std::optional<uintptr_t> wait_until(const std::vector<uintptr_t>& addresses, Pred&& pred,
+                                        int timeout_ms) {
+        constexpr auto MIN_POLL_INTERVAL = std::chrono::milliseconds(1);
+        constexpr auto MAX_POLL_INTERVAL = std::chrono::milliseconds(16);
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        auto interval = MIN_POLL_INTERVAL;
+        while (true) {
+            for (uintptr_t address : addresses) {
+                if (pred(read<T>(address)))
+                    return address;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline)
+                return std::nullopt;
+
+            std::this_thread::sleep_for((std::min)(
+                interval, std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now)));
+            interval = (std::min)(interval * 2, MAX_POLL_INTERVAL);
+        }
+    }
 
+    // For scans over many candidates, where one unrelated address taking the value says nothing
+    // about the field being searched for. Polls until at least one address matches and the set
+    // of matching addresses has not changed for SETTLED_TIME, but never returns before
+    // min_wait_ms, and gives up after timeout_ms. pred(i, value) checks addresses[i]. Returns
+    // whether the matches settled.
+    template <typename T, typename Pred>
+    bool wait_until_settled(const std::vector<uintptr_t>& addresses, Pred&& pred, int timeout_ms,
+                            int min_wait_ms = 0) {
+        constexpr auto POLL_INTERVAL = std::chrono::milliseconds(4);
+        constexpr auto SETTLED_TIME = std::chrono::milliseconds(100);
+
+        auto start = std::chrono::steady_clock::now();
+        auto deadline = start + std::chrono::milliseconds(timeout_ms);
+        auto earliest = start + std::chrono::milliseconds(min_wait_ms);
+        std::vector<bool> matched(addresses.size());
+        std::vector<bool> previous;
+        auto stable_since = start;
+        while (true) {
+            bool any = false;
+            for (size_t i = 0; i < addresses.size(); i++) {
+                matched[i] = pred(i, read<T>(addresses[i]));
+                any = any || matched[i];
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            if (matched != previous) {
+                previous = matched;
+                stable_since = now;
+            }
+            if (any && now >= earliest && now - stable_since >= SETTLED_TIME)
+                return true;
+            if (now >= deadline)
+                return false;
+
+            std::this_thread::sleep_for((std::min)(
+                POLL_INTERVAL,
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now)));
+        }
+    }
+
+    // value_changer(i) has to make the game take known_values[i]; it does not need to sleep.
+    // After each change the candidates are watched until they show the new value (timeout_ms
+    // at most) before they are filtered. A seeded scan watches a single known address, so the
+    // first time it shows the value is the change that was made. An unseeded scan waits with
+    // wait_until_settled, because with hundreds of candidates an unrelated byte flipping to the
+    // value would end the wait before the real field updates. min_wait_ms holds off the filter
+    // either way, for state the game only updates some frames later (physics, say).
     template <typename T>
     std::vector<size_t> find_offsets_with_snapshots(uintptr_t base_address,
                                                     const std::vector<T>& known_values,
                                                     std::function<void(size_t)> value_changer,
                                                     size_t max_offset = 0x1000,
-                                                    size_t alignment = 0x8, int sleep_ms = 500) {
+                                                    size_t alignment = 0x8, int timeout_ms = 500,
+                                                    std::optional<size_t> hint = std::nullopt,
+                                                    int min_wait_ms = 0) {
+        constexpr auto SETTLE_TIME = std::chrono::milliseconds(16);
+
+        event_log::Find event("find_offsets_with_snapshots", base_address, max_offset, alignment,
+                              hint);
+
+        // a hint that still holds the first value is tracked on its own; every other candidate
+        // is kept in nearest-first order so callers taking the front get the closest match
         std::vector<size_t> candidates;
-        for (size_t offset = 0; offset < max_offset; offset += alignment) {
-            T value = read<T>(base_address + offset);
-            if (value == known_values[0])
-                candidates.push_back(offset);
+        bool seeded =
+            hint && *hint < max_offset && read<T>(base_address + *hint) == known_values[0];
+        if (seeded) {
+            candidates.push_back(*hint);
+        } else {
+            probe_offsets(0, max_offset, alignment, hint, [&](size_t offset) {
+                T value = read<T>(base_address + offset);
+                if (value == known_values[0])
+                    candidates.push_back(offset);
+                return false;
+            });
         }
 
         if (candidates.empty())
             return {};
 
+        auto wait_for_value = [&](size_t i) {
+            // every candidate still holds known_values[i - 1], so an unchanged value has nothing
+            // to wait for
+            if (known_values[i] == known_values[i - 1])
+                return;
+
+            std::vector<uintptr_t> addresses;
+            addresses.reserve(candidates.size());
+            for (size_t offset : candidates)
+                addresses.push_back(base_address + offset);
+
+            const T& expected = known_values[i];
+            if (!seeded) {
+                wait_until_settled<T>(
+                    addresses, [&](size_t, const T& value) { return value == expected; },
+                    timeout_ms, min_wait_ms);
+                return;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            if (wait_until<T>(addresses, [&](const T& value) { return value == expected; },
+                              timeout_ms))
+                std::this_thread::sleep_for(SETTLE_TIME);
+            std::this_thread::sleep_until(start + std::chrono::milliseconds(min_wait_ms));
+        };
+
         for (size_t i = 1; i < known_values.size(); i++) {
             value_changer(i);
-            std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
+            wait_for_value(i);
 
             std::vector<size_t> new_candidates;
             for (size_t offset : candidates) {
@@ -156,6 +288,17 @@ class Memory {
             }
 
             candidates = std::move(new_candidates);
+            if (candidates.empty() && seeded) {
+                // the hinted offset moved; put the value back and do the full search
+                value_changer(0);
+                std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+                auto retried = find_offsets_with_snapshots(base_address, known_values,
+                                                           value_changer, max_offset, alignment,
+                                                           timeout_ms, std::nullopt, min_wait_ms);
+                if (!retried.empty())
+                    event.result = retried.front();
+                return retried;
+            }
             if (candidates.empty()) {
                 LOG_ERR("No candidates remaining after snapshot {}", i);
                 return {};
@@ -169,28 +312,35 @@ class Memory {
                 verified.push_back(offset);
         }
 
+        if (!verified.empty())
+            event.result = verified.front();
         return verified;
     }
 
     std::optional<size_t> find_vector3_offset(const std::vector<uintptr_t>& addresses,
                                               const std::vector<::Vector3>& expected_values,
-                                              size_t search_range = 0x1000, float epsilon = 0.01f) {
+                                              size_t search_range = 0x1000, float epsilon = 0.01f,
+                                              std::optional<size_t> hint = std::nullopt) {
         return find_verified_offset_custom<::Vector3>(
             addresses, expected_values,
             [epsilon](const ::Vector3& a, const ::Vector3& b) { return a.equals(b, epsilon); },
-            search_range, 0x4);
+            search_range, 0x4, hint);
     }
 
     template <typename T, typename Comparator>
     std::optional<size_t>
     find_verified_offset_custom(const std::vector<uintptr_t>& addresses,
                                 const std::vector<T>& expected_values, Comparator compare,
-                                size_t search_range = 0x1000, size_t alignment = 0x4) {
+                                size_t search_range = 0x1000, size_t alignment = 0x4,
+                                std::optional<size_t> hint = std::nullopt) {
         if (addresses.size() != expected_values.size() || addresses.empty()) {
             return std::nullopt;
         }
 
-        for (size_t offset = 0; offset < search_range; offset += alignment) {
+        event_log::Find event("find_verified_offset_custom", addresses.front(), search_range,
+                              alignment, hint);
+        std::optional<size_t> result;
+        probe_offsets(0, search_range, alignment, hint, [&](size_t offset) {
             bool all_match = true;
 
             for (size_t i = 0; i < addresses.size(); i++) {
@@ -203,16 +353,20 @@ class Memory {
             }
 
             if (all_match) {
-                return offset;
+                result = offset;
             }
-        }
+            return all_match;
+        });
 
-        return std::nullopt;
+        event.result = result;
+        return result;
     }
 
     std::vector<uint8_t> read_bytes(uintptr_t address, size_t size);
     bool read_raw(uintptr_t address, void* buffer, size_t size);
 
+    std::optional<IMAGE_NT_HEADERS64> get_nt_headers();
+    std::vector<IMAGE_SECTION_HEADER> get_section_headers();
     std::optional<std::pair<uintptr_t, size_t>> get_section_range(const char* section_name);
 
     std::string read_string(uintptr_t address, size_t max_length = 256);
@@ -220,37 +374,85 @@ class Memory {
 
     std::optional<RttiInfo> scan_rtti(uintptr_t address);
     std::optional<size_t> find_rtti_offset(uintptr_t base_address, const std::string& target_class,
-                                           size_t max_offset = 0x1000, size_t alignment = 0x8);
+                                           size_t max_offset = 0x1000, size_t alignment = 0x8,
+                                           std::optional<size_t> hint = std::nullopt);
     std::optional<size_t> find_rtti_offset_nth(uintptr_t base_address, const std::string& target_class,
                                                 size_t nth_index, size_t max_offset = 0x1000,
                                                 size_t alignment = 0x8);
     std::optional<uintptr_t> find_pointer_by_rtti(const std::string& target_rtti,
                                                   size_t scan_size = 0x10000000,
-                                                  size_t alignment = 0x8);
+                                                  size_t alignment = 0x8,
+                                                  std::optional<size_t> hint = std::nullopt);
     std::vector<RttiInfo> scan_all_rtti(uintptr_t base_address, size_t max_offset = 0x2000,
                                         size_t alignment = 0x8);
 
     std::optional<RobloxStringInfo> scan_roblox_string(uintptr_t instance_address,
                                                        const std::string& expected_name,
                                                        size_t max_pointer_offset = 0x200,
-                                                       size_t alignment = 0x8);
+                                                       size_t alignment = 0x8,
+                                                       std::optional<size_t> hint = std::nullopt);
     std::optional<size_t> find_roblox_string_direct(uintptr_t base_address,
                                                     const std::string& expected_name,
                                                     size_t max_offset = 0x1000,
-                                                    size_t alignment = 0x8);
+                                                    size_t alignment = 0x8,
+                                                    std::optional<size_t> hint = std::nullopt);
     std::optional<size_t> find_string_direct(uintptr_t base_address,
                                              const std::string& expected_string,
                                              size_t max_offset = 0x1000, size_t alignment = 0x8,
-                                             size_t max_string_length = 256);
+                                             size_t max_string_length = 256,
+                                             std::optional<size_t> hint = std::nullopt);
     std::optional<size_t> find_string_by_regex(uintptr_t base_address,
                                                const std::string& regex_pattern,
                                                size_t max_offset = 0x1000, size_t alignment = 0x8,
-                                               size_t max_string_length = 256);
+                                               size_t max_string_length = 256,
+                                               std::optional<size_t> hint = std::nullopt);
 
     static DWORD find_process_id(std::string process_name);
     static HANDLE nt_open_process(DWORD process_id);
     static MODULEENTRY32W get_module_by_name(DWORD process_id, std::string module_name);
     std::string get_executable_path();
-};
+    // "version-<hash>" from the client's install directory, or empty if it does not match
+    std::string get_roblox_version();
+
+    // Visits start_offset, start_offset + alignment, ... below max_offset and stops as soon as
+    // visit returns true. With a hint inside the window the walk starts at the hint (snapped to
+    // the alignment grid) and fans out: hint, hint + a, hint - a, hint + 2a, hint - 2a, ...
+    template <typename Visit>
+    static void probe_offsets(size_t start_offset, size_t max_offset, size_t alignment,
+                              std::optional<size_t> hint, Visit&& visit) {
+        if (!alignment || start_offset >= max_offset)
+            return;
+
+        if (!hint || *hint < start_offset || *hint >= max_offset) {
+            for (size_t offset = start_offset; offset < max_offset; offset += alignment) {
+                if (visit(offset))
+                    return;
+            }
+            return;
+        }
+
+        size_t center = start_offset + (*hint - start_offset) / alignment * alignment;
+        if (visit(center))
+            return;
+
+        for (size_t step = alignment;; step += alignment) {
+            bool up = step < max_offset - center;
+            bool down = step <= center - start_offset;
+            if (!up && !down)
+                return;
+            if (up && visit(center + step))
+                return;
+            if (down && visit(center - step))
+                return;
+        }
+    }
+
+  private:
+    uintptr_t module_base = 0;
 
-inline std::unique_ptr<Memory> memory;
\ No newline at end of file
+    // base_address() of an attached process, looked up once per process_id so re-attaching to
+    // a restarted client does not hand out the old image base
+    std::mutex base_mutex;
+    DWORD base_process_id = 0;
+    uintptr_t cached_base = 0;
+};
\ No newline at end of file
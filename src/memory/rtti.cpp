@@ -85,24 +85,31 @@ std::optional<RttiInfo> Memory::scan_rtti(uintptr_t address) {
 
 std::optional<size_t> Memory::find_rtti_offset(uintptr_t base_address,
                                                const std::string& target_class, size_t max_offset,
-                                               size_t alignment) {
-    for (size_t offset = 0; offset < max_offset; offset += alignment) {
+                                               size_t alignment, std::optional<size_t> hint) {
+    event_log::Find event("find_rtti_offset", base_address, max_offset, alignment, hint,
+                          target_class);
+    std::optional<size_t> result;
+    probe_offsets(0, max_offset, alignment, hint, [&](size_t offset) {
         uintptr_t current_address = base_address + offset;
         uintptr_t pointer_value = read<uintptr_t>(current_address);
 
         if (!pointer_value || pointer_value < 0x10000)
-            continue;
+            return false;
 
         auto rtti = scan_rtti(pointer_value);
         if (rtti && rtti->name == target_class)
-            return offset;
-    }
-    return std::nullopt;
+            result = offset;
+        return result.has_value();
+    });
+    event.result = result;
+    return result;
 }
 
 std::optional<size_t> Memory::find_rtti_offset_nth(uintptr_t base_address,
                                                     const std::string& target_class, size_t nth_index,
                                                     size_t max_offset, size_t alignment) {
+    event_log::Find event("find_rtti_offset_nth", base_address, max_offset, alignment,
+                          std::nullopt, target_class);
     size_t match_count = 0;
     for (size_t offset = 0; offset < max_offset; offset += alignment) {
         uintptr_t current_address = base_address + offset;
@@ -114,6 +121,7 @@ std::optional<size_t> Memory::find_rtti_offset_nth(uintptr_t base_address,
         auto rtti = scan_rtti(pointer_value);
         if (rtti && rtti->name == target_class) {
             if (match_count == nth_index) {
+                event.result = offset;
                 return offset;
             }
             match_count++;
@@ -123,7 +131,8 @@ std::optional<size_t> Memory::find_rtti_offset_nth(uintptr_t base_address,
 }
 
 std::optional<uintptr_t> Memory::find_pointer_by_rtti(const std::string& target_rtti,
-                                                      size_t scan_size, size_t alignment) {
+                                                      size_t scan_size, size_t alignment,
+                                                      std::optional<size_t> hint) {
     uintptr_t module_base = base_address();
     size_t start_offset = 0;
 
@@ -138,16 +147,23 @@ std::optional<uintptr_t> Memory::find_pointer_by_rtti(const std::string& target_
         }
     }
 
-    for (size_t offset = start_offset; offset < start_offset + scan_size; offset += alignment) {
+    event_log::Find event("find_pointer_by_rtti", module_base, start_offset + scan_size,
+                          alignment, hint, target_rtti);
+    std::optional<uintptr_t> result;
+    probe_offsets(start_offset, start_offset + scan_size, alignment, hint, [&](size_t offset) {
         uintptr_t potential_ptr = read<uintptr_t>(module_base + offset);
         if (potential_ptr < 0x10000 || potential_ptr > 0x7FFFFFFFFFFF)
-            continue;
+            return false;
 
         auto rtti = scan_rtti(potential_ptr);
         if (rtti && rtti->name == target_rtti) {
-            return offset;
+            result = offset;
         }
-    }
+        return result.has_value();
+    });
+    event.result = result;
+    if (result)
+        return result;
 
     LOG_ERR("Failed to find {} via RTTI (single-threaded scan over 0x{:X} bytes)", target_rtti,
             scan_size);
@@ -1,5 +1,5 @@
 #pragma once
-#include <Windows.h>
+#include "memory/platform.h"
 #include <cstdint>
 #include <optional>
 #include <string>
@@ -0,0 +1,129 @@
+#pragma once
+#include "control/control.hpp"
+#include "memory/memory.h"
+#include "utils/logger.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace scanner {
+
+    // A boolean property that the bridge can toggle, e.g. {"set_tool_enabled", {}} or
+    // {"set_part_locked", {{"part_name", "Part"}}}. "value" is added to data on every step.
+    struct FlagProbe {
+        std::string action;
+        nlohmann::json data = nlohmann::json::object();
+        std::optional<size_t> hint = std::nullopt;
+    };
+
+    // Finds several independent bool offsets on one object at once. Every probe gets its own
+    // on/off pattern; each step sets all of them in a single batch (so in the same frame), waits
+    // once and filters every probe's candidates against one snapshot of the object. That is one
+    // wait per step for the whole group instead of one per step per property. settle_ms is the
+    // initial settle time and the upper bound for each later wait.
+    //
+    // Results line up with probes; nullopt for a probe whose candidates all died.
+    inline std::vector<std::optional<size_t>>
+    find_flag_offsets(Memory& mem, control::Controller& controller, uintptr_t address,
+                      const std::vector<FlagProbe>& probes, size_t max_offset, int settle_ms) {
+        std::vector<std::optional<size_t>> found(probes.size());
+        if (probes.empty())
+            return found;
+
+        // codes with as many set bits as clear ones: never constant, and no two probes share one
+        const size_t steps = probes.size() <= 6 ? 4 : 6;
+        std::vector<uint32_t> codes;
+        for (uint32_t code = 0; code < (1u << steps) && codes.size() < probes.size(); code++) {
+            if (size_t(std::popcount(code)) == steps / 2)
+                codes.push_back(code);
+        }
+        if (codes.size() < probes.size()) {
+            LOG_ERR("Too many flags in one group ({}), split them up", probes.size());
+            return found;
+        }
+
+        auto value_at = [&](size_t probe, size_t step) -> uint8_t {
+            return (codes[probe] >> (steps - 1 - step)) & 1;
+        };
+
+        std::vector<std::vector<size_t>> candidates(probes.size());
+        for (size_t step = 0; step < steps; step++) {
+            std::vector<control::BatchCommand> batch;
+            for (size_t p = 0; p < probes.size(); p++) {
+                nlohmann::json data = probes[p].data;
+                data["value"] = value_at(p, step) == 1;
+                batch.push_back({probes[p].action, data});
+            }
+
+            auto results = controller.execute_batch(batch);
+            if (!results.has_value()) {
+                LOG_ERR("Flag batch failed at step {}", step);
+                return found;
+            }
+            for (size_t p = 0; p < probes.size(); p++) {
+                if ((*results)[p].status != "completed")
+                    LOG_WARN("{} failed: {}", probes[p].action, (*results)[p].result.dump());
+            }
+
+            if (step == 0) {
+                // nothing to watch yet; the whole object gets read below
+                std::this_thread::sleep_for(std::chrono::milliseconds(settle_ms));
+            } else {
+                // watch the candidates of every flipped probe together until the ones showing
+                // their new value stop changing; the first unrelated byte that happens to flip
+                // says nothing about whether the real flags have updated yet
+                std::vector<uintptr_t> addresses;
+                std::vector<uint8_t> expected;
+                for (size_t p = 0; p < probes.size(); p++) {
+                    uint8_t value = value_at(p, step);
+                    if (value == value_at(p, step - 1))
+                        continue;
+                    for (size_t offset : candidates[p]) {
+                        addresses.push_back(address + offset);
+                        expected.push_back(value);
+                    }
+                }
+                mem.wait_until_settled<uint8_t>(
+                    addresses, [&](size_t i, uint8_t value) { return value == expected[i]; },
+                    settle_ms);
+            }
+
+            auto snapshot = mem.read_bytes(address, max_offset);
+            if (snapshot.size() < max_offset) {
+                LOG_ERR("Failed to snapshot 0x{:X} bytes at 0x{:X}", max_offset, address);
+                return found;
+            }
+
+            for (size_t p = 0; p < probes.size(); p++) {
+                uint8_t expected = value_at(p, step);
+                if (step == 0) {
+                    for (size_t offset = 0; offset < max_offset; offset++) {
+                        if (snapshot[offset] == expected)
+                            candidates[p].push_back(offset);
+                    }
+                } else {
+                    std::erase_if(candidates[p],
+                                  [&](size_t offset) { return snapshot[offset] != expected; });
+                }
+            }
+        }
+
+        for (size_t p = 0; p < probes.size(); p++) {
+            const auto& survivors = candidates[p];
+            if (survivors.empty())
+                continue;
+
+            auto hinted = probes[p].hint ? std::find(survivors.begin(), survivors.end(),
+                                                     *probes[p].hint)
+                                         : survivors.end();
+            found[p] = hinted != survivors.end() ? *hinted : survivors.front();
+        }
+        return found;
+    }
+
+} // namespace scanner
@@ -10,7 +10,8 @@
 namespace scanner::phases {
 
     inline bool atmosphere(Context& ctx) {
-        const auto lighting = sdk::instance_t(ctx.data_model).find_first_child("Lighting");
+        const auto lighting =
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("Lighting");
         if (!lighting.is_valid()) {
             LOG_ERR("Failed to find Lighting");
             return false;
@@ -23,7 +24,9 @@ namespace scanner::phases {
         }
 
         const auto density_offset =
-            memory->find_verified_offset_float({atmosphere_inst.address}, {0.677f}, 0x1000, 0x2);
+            ctx.memory->find_verified_offset_float({atmosphere_inst.address}, {0.677f}, 0x1000, 0x2,
+                                                   0.01f,
+                                                   offset_registry.seed("Atmosphere", "Density"));
 
         if (!density_offset) {
             LOG_ERR("Failed to find Density offset");
@@ -34,7 +37,9 @@ namespace scanner::phases {
 
         // holy fuck nice var name
         const auto offset_offset =
-            memory->find_verified_offset_float({atmosphere_inst.address}, {0.385f}, 0x1000, 0x2);
+            ctx.memory->find_verified_offset_float({atmosphere_inst.address}, {0.385f}, 0x1000, 0x2,
+                                                   0.01f,
+                                                   offset_registry.seed("Atmosphere", "Offset"));
 
         if (!density_offset) {
             LOG_ERR("Failed to find Offset offset");
@@ -44,7 +49,9 @@ namespace scanner::phases {
         offset_registry.add("Atmosphere", "Offset", *offset_offset);
 
         const auto glare_offset =
-            memory->find_verified_offset_float({atmosphere_inst.address}, {5.13f}, 0x1000, 0x2);
+            ctx.memory->find_verified_offset_float({atmosphere_inst.address}, {5.13f}, 0x1000, 0x2,
+                                                   0.01f,
+                                                   offset_registry.seed("Atmosphere", "Glare"));
 
         if (!glare_offset) {
             LOG_ERR("Failed to find Glare offset");
@@ -54,7 +61,9 @@ namespace scanner::phases {
         offset_registry.add("Atmosphere", "Glare", *glare_offset);
 
         const auto haze_offset =
-            memory->find_verified_offset_float({atmosphere_inst.address}, {7.78f}, 0x1000, 0x2);
+            ctx.memory->find_verified_offset_float({atmosphere_inst.address}, {7.78f}, 0x1000, 0x2,
+                                                   0.01f,
+                                                   offset_registry.seed("Atmosphere", "Haze"));
 
         if (!haze_offset) {
             LOG_ERR("Failed to find Haze offset");
@@ -67,12 +76,13 @@ namespace scanner::phases {
         constexpr float ATM_COLOR_G = 92.0f / 255.0f;
         constexpr float ATM_COLOR_B = 231.0f / 255.0f;
 
-        auto atm_color_offset = memory->find_verified_offset_float({atmosphere_inst.address},
-                                                                   {ATM_COLOR_R}, 0x600, 0x4);
+        auto atm_color_offset = ctx.memory->find_verified_offset_float(
+            {atmosphere_inst.address}, {ATM_COLOR_R}, 0x600, 0x4, 0.01f,
+            offset_registry.seed("Atmosphere", "Color"));
 
         if (atm_color_offset) {
-            float g = memory->read<float>(atmosphere_inst.address + *atm_color_offset + 4);
-            float b = memory->read<float>(atmosphere_inst.address + *atm_color_offset + 8);
+            float g = ctx.memory->read<float>(atmosphere_inst.address + *atm_color_offset + 4);
+            float b = ctx.memory->read<float>(atmosphere_inst.address + *atm_color_offset + 8);
             if (std::abs(g - ATM_COLOR_G) < 0.01f && std::abs(b - ATM_COLOR_B) < 0.01f) {
                 offset_registry.add("Atmosphere", "Color", *atm_color_offset);
             } else {
@@ -91,10 +101,10 @@ namespace scanner::phases {
             if (atm_color_offset && offset == *atm_color_offset)
                 continue;
 
-            float r = memory->read<float>(atmosphere_inst.address + offset);
+            float r = ctx.memory->read<float>(atmosphere_inst.address + offset);
             if (std::abs(r - DECAY_R) < 0.01f) {
-                float g = memory->read<float>(atmosphere_inst.address + offset + 4);
-                float b = memory->read<float>(atmosphere_inst.address + offset + 8);
+                float g = ctx.memory->read<float>(atmosphere_inst.address + offset + 4);
+                float b = ctx.memory->read<float>(atmosphere_inst.address + offset + 8);
                 if (std::abs(g - DECAY_G) < 0.01f && std::abs(b - DECAY_B) < 0.01f) {
                     decay_offset_final = offset;
                     break;
@@ -9,7 +9,7 @@
 namespace scanner::phases {
 
     inline bool BasePart(Context& ctx) {
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
         constexpr int PROP_SLEEP_MS = 150;
 
         if (!ctx.workspace.is_valid()) {
@@ -77,36 +77,39 @@ namespace scanner::phases {
         constexpr size_t PART_SCAN_RANGE = 0x300;
         constexpr size_t ALIGNMENT = 0x4;
 
-        auto primitive_offset = memory->find_rtti_offset(part1.address, "Primitive@RBX");
+        auto primitive_offset =
+            ctx.memory->find_rtti_offset(part1.address, "Primitive@RBX", 0x1000, 0x8,
+                                         offset_registry.seed("Part", "Primitive"));
         if (!primitive_offset) {
             LOG_ERR("Failed to find Primitive offset");
             return false;
         }
         offset_registry.add("Part", "Primitive", *primitive_offset);
 
-        auto primitive1 = memory->read<uintptr_t>(part1.address + *primitive_offset);
+        auto primitive1 = ctx.memory->read<uintptr_t>(part1.address + *primitive_offset);
         if (!primitive1) {
             LOG_ERR("Failed to read Primitive pointer for part1");
             return false;
         }
 
-        auto primitive2 = memory->read<uintptr_t>(part2.address + *primitive_offset);
+        auto primitive2 = ctx.memory->read<uintptr_t>(part2.address + *primitive_offset);
         if (!primitive2) {
             LOG_ERR("Failed to read Primitive pointer for part2");
             return false;
         }
 
-        auto primitive3 = memory->read<uintptr_t>(part3.address + *primitive_offset);
+        auto primitive3 = ctx.memory->read<uintptr_t>(part3.address + *primitive_offset);
         if (!primitive3) {
             LOG_ERR("Failed to read Primitive pointer for part3");
             return false;
         }
 
-        auto pos_offset = memory->find_vector3_offset({primitive1, primitive2, primitive3},
-                                                      {{PART1_POS_X, PART1_POS_Y, PART1_POS_Z},
-                                                       {PART2_POS_X, PART2_POS_Y, PART2_POS_Z},
-                                                       {PART3_POS_X, PART3_POS_Y, PART3_POS_Z}},
-                                                      PRIMITIVE_SCAN_RANGE);
+        auto pos_offset = ctx.memory->find_vector3_offset({primitive1, primitive2, primitive3},
+                                                          {{PART1_POS_X, PART1_POS_Y, PART1_POS_Z},
+                                                           {PART2_POS_X, PART2_POS_Y, PART2_POS_Z},
+                                                           {PART3_POS_X, PART3_POS_Y, PART3_POS_Z}},
+                                                          PRIMITIVE_SCAN_RANGE, 0.01f,
+                                                          offset_registry.seed("Part", "Position"));
 
         if (!pos_offset) {
             LOG_ERR("Failed to find Position offset");
@@ -117,11 +120,12 @@ namespace scanner::phases {
         offset_registry.add("Part", "Rotation", *pos_offset - 36);
 
         const auto size_offset =
-            memory->find_vector3_offset({primitive1, primitive2, primitive3},
-                                        {{PART1_SIZE_X, PART1_SIZE_Y, PART1_SIZE_Z},
-                                         {PART2_SIZE_X, PART2_SIZE_Y, PART2_SIZE_Z},
-                                         {PART3_SIZE_X, PART3_SIZE_Y, PART3_SIZE_Z}},
-                                        PRIMITIVE_SCAN_RANGE);
+            ctx.memory->find_vector3_offset({primitive1, primitive2, primitive3},
+                                            {{PART1_SIZE_X, PART1_SIZE_Y, PART1_SIZE_Z},
+                                             {PART2_SIZE_X, PART2_SIZE_Y, PART2_SIZE_Z},
+                                             {PART3_SIZE_X, PART3_SIZE_Y, PART3_SIZE_Z}},
+                                            PRIMITIVE_SCAN_RANGE, 0.01f,
+                                            offset_registry.seed("Part", "Size"));
 
         if (!size_offset) {
             LOG_ERR("Failed to find Size offset");
@@ -129,21 +133,21 @@ namespace scanner::phases {
         }
         offset_registry.add("Part", "Size", *size_offset);
 
-        auto color_offset = memory->find_verified_offset<uint8_t>(
+        auto color_offset = ctx.memory->find_verified_offset<uint8_t>(
             {part1.address, part2.address, part3.address}, {PART1_R, PART2_R, PART3_R},
-            PART_SCAN_RANGE, 0x1);
+            PART_SCAN_RANGE, 0x1, offset_registry.seed("Part", "Color3"));
 
         if (!color_offset) {
             LOG_ERR("Failed to find Color3 offset");
             return false;
         }
 
-        uint8_t b1 = memory->read<uint8_t>(part1.address + *color_offset + 1);
-        uint8_t g1 = memory->read<uint8_t>(part1.address + *color_offset + 2);
-        uint8_t b2 = memory->read<uint8_t>(part2.address + *color_offset + 1);
-        uint8_t g2 = memory->read<uint8_t>(part2.address + *color_offset + 2);
-        uint8_t b3 = memory->read<uint8_t>(part3.address + *color_offset + 1);
-        uint8_t g3 = memory->read<uint8_t>(part3.address + *color_offset + 2);
+        uint8_t b1 = ctx.memory->read<uint8_t>(part1.address + *color_offset + 1);
+        uint8_t g1 = ctx.memory->read<uint8_t>(part1.address + *color_offset + 2);
+        uint8_t b2 = ctx.memory->read<uint8_t>(part2.address + *color_offset + 1);
+        uint8_t g2 = ctx.memory->read<uint8_t>(part2.address + *color_offset + 2);
+        uint8_t b3 = ctx.memory->read<uint8_t>(part3.address + *color_offset + 1);
+        uint8_t g3 = ctx.memory->read<uint8_t>(part3.address + *color_offset + 2);
 
         if (!(b1 == PART1_B && g1 == PART1_G && b2 == PART2_B && g2 == PART2_G && b3 == PART3_B &&
               g3 == PART3_G)) {
@@ -152,10 +156,10 @@ namespace scanner::phases {
         }
         offset_registry.add("Part", "Color3", *color_offset);
 
-        auto transparency_offset = memory->find_verified_offset_float(
+        auto transparency_offset = ctx.memory->find_verified_offset_float(
             {part1.address, part2.address, part3.address},
             {PART1_TRANSPARENCY, PART2_TRANSPARENCY, PART3_TRANSPARENCY}, PART_SCAN_RANGE,
-            ALIGNMENT);
+            ALIGNMENT, 0.01f, offset_registry.seed("Part", "Transparency"));
 
         if (!transparency_offset) {
             LOG_ERR("Failed to find Transparency offset");
@@ -163,9 +167,9 @@ namespace scanner::phases {
         }
         offset_registry.add("Part", "Transparency", *transparency_offset);
 
-        auto shape_offset = memory->find_verified_offset<uint8_t>(
+        auto shape_offset = ctx.memory->find_verified_offset<uint8_t>(
             {part1.address, part2.address, part3.address}, {PART1_SHAPE, PART2_SHAPE, PART3_SHAPE},
-            PART_SCAN_RANGE, 0x1);
+            PART_SCAN_RANGE, 0x1, offset_registry.seed("Part", "Shape"));
 
         if (!shape_offset) {
             LOG_ERR("Failed to find Shape offset");
@@ -175,9 +179,9 @@ namespace scanner::phases {
 
         bool found_flags = false;
         for (size_t offset = 0; offset < 0x300; offset += 0x1) {
-            uint8_t flags1 = memory->read<uint8_t>(primitive1 + offset);
-            uint8_t flags2 = memory->read<uint8_t>(primitive2 + offset);
-            uint8_t flags3 = memory->read<uint8_t>(primitive3 + offset);
+            uint8_t flags1 = ctx.memory->read<uint8_t>(primitive1 + offset);
+            uint8_t flags2 = ctx.memory->read<uint8_t>(primitive2 + offset);
+            uint8_t flags3 = ctx.memory->read<uint8_t>(primitive3 + offset);
 
             bool anchored_match =
                 ((flags1 & 0x2) != 0) && ((flags2 & 0x2) != 0) && ((flags3 & 0x2) != 0);
@@ -201,9 +205,9 @@ namespace scanner::phases {
             return false;
         }
 
-        auto material_offset = memory->find_verified_offset<uint16_t>(
+        auto material_offset = ctx.memory->find_verified_offset<uint16_t>(
             {primitive1, primitive2, primitive3}, {PART1_MATERIAL, PART2_MATERIAL, PART3_MATERIAL},
-            PRIMITIVE_SCAN_RANGE, 0x2);
+            PRIMITIVE_SCAN_RANGE, 0x2, offset_registry.seed("Part", "Material"));
 
         if (!material_offset) {
             LOG_ERR("Failed to find Material offset");
@@ -211,9 +215,10 @@ namespace scanner::phases {
         }
         offset_registry.add("Part", "Material", *material_offset);
 
-        auto reflectance_offset = memory->find_verified_offset_float(
+        auto reflectance_offset = ctx.memory->find_verified_offset_float(
             {part1.address, part2.address, part3.address},
-            {PART1_REFLECTANCE, PART2_REFLECTANCE, PART3_REFLECTANCE}, PART_SCAN_RANGE, ALIGNMENT);
+            {PART1_REFLECTANCE, PART2_REFLECTANCE, PART3_REFLECTANCE}, PART_SCAN_RANGE, ALIGNMENT,
+            0.01f, offset_registry.seed("Part", "Reflectance"));
 
         if (!reflectance_offset) {
             LOG_ERR("Failed to find Reflectance offset");
@@ -227,13 +232,12 @@ namespace scanner::phases {
         std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
 
         std::vector<uint8_t> cast_shadow_values = {1, 0, 1, 0};
-        auto cast_shadow_offsets = memory->find_offsets_with_snapshots<uint8_t>(
+        auto cast_shadow_offsets = ctx.memory->find_offsets_with_snapshots<uint8_t>(
             part1.address, cast_shadow_values,
             [&](size_t i) {
                 controller.set_part_cast_shadow("Part1", cast_shadow_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
             },
-            PART_SCAN_RANGE, 0x1);
+            PART_SCAN_RANGE, 0x1, PROP_SLEEP_MS + 500, offset_registry.seed("Part", "CastShadow"));
 
         if (cast_shadow_offsets.empty()) {
             LOG_ERR("Failed to find CastShadow offset");
@@ -247,13 +251,12 @@ namespace scanner::phases {
         std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
 
         std::vector<uint8_t> locked_values = {0, 1, 0, 1};
-        auto locked_offsets = memory->find_offsets_with_snapshots<uint8_t>(
+        auto locked_offsets = ctx.memory->find_offsets_with_snapshots<uint8_t>(
             part1.address, locked_values,
             [&](size_t i) {
                 controller.set_part_locked("Part1", locked_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
             },
-            PART_SCAN_RANGE, 0x1);
+            PART_SCAN_RANGE, 0x1, PROP_SLEEP_MS + 500, offset_registry.seed("Part", "Locked"));
 
         if (locked_offsets.empty()) {
             LOG_ERR("Failed to find Locked offset");
@@ -267,13 +270,12 @@ namespace scanner::phases {
         std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
 
         std::vector<uint8_t> massless_values = {0, 1, 0, 1};
-        auto massless_offsets = memory->find_offsets_with_snapshots<uint8_t>(
+        auto massless_offsets = ctx.memory->find_offsets_with_snapshots<uint8_t>(
             part1.address, massless_values,
             [&](size_t i) {
                 controller.set_part_massless("Part1", massless_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
             },
-            PART_SCAN_RANGE, 0x1);
+            PART_SCAN_RANGE, 0x1, PROP_SLEEP_MS + 500, offset_registry.seed("Part", "Massless"));
 
         if (massless_offsets.empty()) {
             LOG_ERR("Failed to find Massless offset");
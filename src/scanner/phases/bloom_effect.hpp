@@ -10,7 +10,8 @@
 namespace scanner::phases {
 
     inline bool bloom_effect(Context& ctx) {
-        const auto lighting = sdk::instance_t(ctx.data_model).find_first_child("Lighting");
+        const auto lighting =
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("Lighting");
         if (!lighting.is_valid()) {
             LOG_ERR("Failed to find Lighting");
             return false;
@@ -23,7 +24,9 @@ namespace scanner::phases {
         }
 
         const auto intensity_offset =
-            memory->find_verified_offset_float({bloom_effect_inst.address}, {0.6f}, 0x400, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {bloom_effect_inst.address}, {0.6f}, 0x400, 0x2, 0.01f,
+                offset_registry.seed("BloomEffect", "Intensity"));
 
         if (!intensity_offset) {
             LOG_ERR("Failed to find Intensity offset for BloomEffect");
@@ -33,7 +36,9 @@ namespace scanner::phases {
         offset_registry.add("BloomEffect", "Intensity", *intensity_offset);
 
         const auto size_offset =
-            memory->find_verified_offset_float({bloom_effect_inst.address}, {33.0f}, 0x400, 0x2);
+            ctx.memory->find_verified_offset_float({bloom_effect_inst.address}, {33.0f}, 0x400, 0x2,
+                                                   0.01f,
+                                                   offset_registry.seed("BloomEffect", "Size"));
 
         if (!size_offset) {
             LOG_ERR("Failed to find Size offset for BloomEffect");
@@ -43,7 +48,9 @@ namespace scanner::phases {
         offset_registry.add("BloomEffect", "Size", *size_offset);
 
         const auto threshold_offset =
-            memory->find_verified_offset_float({bloom_effect_inst.address}, {2.947f}, 0x400, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {bloom_effect_inst.address}, {2.947f}, 0x400, 0x2, 0.01f,
+                offset_registry.seed("BloomEffect", "Threshold"));
 
         if (!threshold_offset) {
             LOG_ERR("Failed to find Threshold offset for BloomEffect");
@@ -22,7 +22,7 @@ namespace scanner::phases {
             return false;
         }
 
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
         constexpr int SLEEP_MS = 1000;
 
         // fov (stored in radians, displayed as degrees)
@@ -36,13 +36,12 @@ namespace scanner::phases {
                 fov_radians.push_back(deg * 3.14159265f / 180.0f);
             }
 
-            auto offset = memory->find_offsets_with_snapshots<float>(
+            auto offset = ctx.memory->find_offsets_with_snapshots<float>(
                 camera.address, fov_radians,
                 [&](size_t i) {
                     controller.set_camera_fov(fov_degrees[i]);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
                 },
-                0x600, 0x4);
+                0x600, 0x4, SLEEP_MS + 500, offset_registry.seed("Camera", "FieldOfView"));
 
             if (!offset.empty()) {
                 offset_registry.add("Camera", "FieldOfView", offset[0]);
@@ -60,13 +59,12 @@ namespace scanner::phases {
             std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
 
             std::vector<float> y_values = {50.0f, 150.0f};
-            auto offset = memory->find_offsets_with_snapshots<float>(
+            auto offset = ctx.memory->find_offsets_with_snapshots<float>(
                 camera.address, y_values,
                 [&](size_t i) {
                     controller.set_camera_position(0.0f, y_values[i], 0.0f);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
                 },
-                0x600, 0x4);
+                0x600, 0x4, SLEEP_MS + 500, offset_registry.seed("Camera", "Position", 0x4));
 
             if (!offset.empty()) {
                 offset_registry.add("Camera", "Position", offset[0] - 0x4);
@@ -84,14 +82,13 @@ namespace scanner::phases {
             std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
 
             std::vector<float> rotation_values = {1.0f, 0.70710677f};
-            auto offset = memory->find_offsets_with_snapshots<float>(
+            auto offset = ctx.memory->find_offsets_with_snapshots<float>(
                 camera.address, rotation_values,
                 [&](size_t i) {
                     float angle = (i == 1) ? 45.0f : 0.0f;
                     controller.set_camera_rotation(angle, 0.0f, 0.0f);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
                 },
-                0x600, 0x4);
+                0x600, 0x4, SLEEP_MS + 500, offset_registry.seed("Camera", "Rotation", 0x10));
 
             if (!offset.empty()) {
                 offset_registry.add("Camera", "Rotation", offset[0] - 0x10);
@@ -116,7 +113,7 @@ namespace scanner::phases {
         for (size_t offset = 0; offset < 0x2000; offset += 0x10) {
             float mat[16];
             for (int i = 0; i < 16; i++) {
-                mat[i] = memory->read<float>(ctx.visual_engine + offset + (i * 4));
+                mat[i] = ctx.memory->read<float>(ctx.visual_engine + offset + (i * 4));
             }
             if (is_valid_matrix(mat)) {
                 candidates.push_back(offset);
@@ -129,14 +126,15 @@ namespace scanner::phases {
 
             std::vector<float> y_snapshots;
             for (size_t i = 0; i < std::min(candidates.size(), size_t(5)); i++) {
-                y_snapshots.push_back(memory->read<float>(ctx.visual_engine + candidates[i] + 28));
+                y_snapshots.push_back(
+                    ctx.memory->read<float>(ctx.visual_engine + candidates[i] + 28));
             }
 
             controller.set_camera_position(0.0f, 150.0f, 0.0f);
             std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
 
             for (size_t i = 0; i < y_snapshots.size(); i++) {
-                float y_new = memory->read<float>(ctx.visual_engine + candidates[i] + 28);
+                float y_new = ctx.memory->read<float>(ctx.visual_engine + candidates[i] + 28);
                 if (std::abs(y_snapshots[i] - y_new) > 50.0f) {
                     offset_registry.add("VisualEngine", "ViewMatrix", candidates[i]);
                     break;
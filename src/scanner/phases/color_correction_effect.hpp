@@ -11,7 +11,8 @@
 namespace scanner::phases {
 
     inline bool color_correction_effect(Context& ctx) {
-        const auto lighting = sdk::instance_t(ctx.data_model).find_first_child("Lighting");
+        const auto lighting =
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("Lighting");
         if (!lighting.is_valid()) {
             LOG_ERR("Failed to find Lighting");
             return false;
@@ -23,10 +24,12 @@ namespace scanner::phases {
             return false;
         }
 
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
 
         const auto brightness_offset =
-            memory->find_verified_offset_float({color_correct_inst.address}, {-0.67f}, 0x200, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {color_correct_inst.address}, {-0.67f}, 0x200, 0x2, 0.01f,
+                offset_registry.seed("ColorCorrectionEffect", "Brightness"));
 
         if (!brightness_offset) {
             LOG_ERR("Failed to find Brightness offset for ColorCorrectEffect");
@@ -36,7 +39,9 @@ namespace scanner::phases {
         offset_registry.add("ColorCorrectionEffect", "Brightness", *brightness_offset);
 
         const auto contrast_offset =
-            memory->find_verified_offset_float({color_correct_inst.address}, {1.123f}, 0x200, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {color_correct_inst.address}, {1.123f}, 0x200, 0x2, 0.01f,
+                offset_registry.seed("ColorCorrectionEffect", "Contrast"));
 
         if (!contrast_offset) {
             LOG_ERR("Failed to find Contrast offset for ColorCorrectEffect");
@@ -46,7 +51,9 @@ namespace scanner::phases {
         offset_registry.add("ColorCorrectionEffect", "Contrast", *contrast_offset);
 
         const auto saturation_offset =
-            memory->find_verified_offset_float({color_correct_inst.address}, {0.269f}, 0x200, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {color_correct_inst.address}, {0.269f}, 0x200, 0x2, 0.01f,
+                offset_registry.seed("ColorCorrectionEffect", "Saturation"));
 
         if (!saturation_offset) {
             LOG_ERR("Failed to find Saturation offset for ColorCorrectEffect");
@@ -59,12 +66,13 @@ namespace scanner::phases {
         constexpr float TINT_G = 118.0f / 255.0f;
         constexpr float TINT_B = 117.0f / 255.0f;
 
-        auto tint_offset = memory->find_verified_offset_float({color_correct_inst.address},
-                                                              {TINT_R}, 0x600, 0x4);
+        auto tint_offset = ctx.memory->find_verified_offset_float(
+            {color_correct_inst.address}, {TINT_R}, 0x600, 0x4, 0.01f,
+            offset_registry.seed("ColorCorrectionEffect", "TintColor"));
 
         if (tint_offset) {
-            float g = memory->read<float>(color_correct_inst.address + *tint_offset + 4);
-            float b = memory->read<float>(color_correct_inst.address + *tint_offset + 8);
+            float g = ctx.memory->read<float>(color_correct_inst.address + *tint_offset + 4);
+            float b = ctx.memory->read<float>(color_correct_inst.address + *tint_offset + 8);
             if (std::abs(g - TINT_G) < 0.01f && std::abs(b - TINT_B) < 0.01f) {
                 offset_registry.add("ColorCorrectionEffect", "TintColor", *tint_offset);
             } else {
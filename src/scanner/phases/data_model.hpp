@@ -8,54 +8,64 @@
 namespace scanner::phases {
 
     inline bool data_model(Context& ctx) {
-        auto fake_dm_offset = memory->find_rtti_offset(ctx.visual_engine, "DataModel@RBX");
+        auto fake_dm_offset = ctx.memory->find_rtti_offset(
+            ctx.visual_engine, "DataModel@RBX", 0x1000, 0x8,
+            offset_registry.seed("VisualEngine", "ToFakeDataModel"));
         if (!fake_dm_offset) {
             LOG_ERR("Failed to find FakeDataModel offset");
             return false;
         }
         offset_registry.add("VisualEngine", "ToFakeDataModel", *fake_dm_offset);
 
-        auto fake_dm = memory->read<uintptr_t>(ctx.visual_engine + *fake_dm_offset);
+        auto fake_dm = ctx.memory->read<uintptr_t>(ctx.visual_engine + *fake_dm_offset);
         if (!fake_dm) {
             LOG_ERR("Failed to read FakeDataModel pointer");
             return false;
         }
 
-        auto real_dm_offset = memory->find_rtti_offset(fake_dm, "DataModel@RBX");
+        auto real_dm_offset = ctx.memory->find_rtti_offset(
+            fake_dm, "DataModel@RBX", 0x1000, 0x8,
+            offset_registry.seed("VisualEngine", "FakeToRealDataModel"));
         if (!real_dm_offset) {
             LOG_ERR("Failed to find RealDataModel offset");
             return false;
         }
         offset_registry.add("VisualEngine", "FakeToRealDataModel", *real_dm_offset);
 
-        ctx.data_model = memory->read<uintptr_t>(fake_dm + *real_dm_offset);
+        ctx.data_model = ctx.memory->read<uintptr_t>(fake_dm + *real_dm_offset);
         if (!ctx.data_model) {
             LOG_ERR("Failed to read DataModel pointer");
             return false;
         }
 
-        auto workspace_offset = memory->find_rtti_offset(ctx.data_model, "Workspace@RBX");
+        auto workspace_offset = ctx.memory->find_rtti_offset(
+            ctx.data_model, "Workspace@RBX", 0x1000, 0x8,
+            offset_registry.seed("DataModel", "Workspace"));
         if (!workspace_offset) {
             LOG_ERR("Failed to find Workspace offset");
             return false;
         }
         offset_registry.add("DataModel", "Workspace", *workspace_offset);
 
-        uintptr_t workspace_addr = memory->read<uintptr_t>(ctx.data_model + *workspace_offset);
+        uintptr_t workspace_addr = ctx.memory->read<uintptr_t>(ctx.data_model + *workspace_offset);
         if (!workspace_addr) {
             LOG_ERR("Failed to read Workspace pointer");
             return false;
         }
-        ctx.workspace = sdk::instance_t(workspace_addr);
+        ctx.workspace = sdk::instance_t(ctx.memory, workspace_addr);
 
-        auto game_id = memory->find_value_offset<uint64_t>(ctx.data_model, settings::game_id());
+        auto game_id = ctx.memory->find_value_offset<uint64_t>(
+            ctx.data_model, settings::game_id(), 0x1000, 0x8, 0, {},
+            offset_registry.seed("DataModel", "GameId"));
         if (!game_id) {
             LOG_ERR("Failed to find GameId offset");
             return false;
         }
         offset_registry.add("DataModel", "GameId", *game_id);
 
-        auto place_id = memory->find_value_offset<uint64_t>(ctx.data_model, settings::place_id());
+        auto place_id = ctx.memory->find_value_offset<uint64_t>(
+            ctx.data_model, settings::place_id(), 0x1000, 0x8, 0, {},
+            offset_registry.seed("DataModel", "PlaceId"));
         if (!place_id) {
             LOG_ERR("Failed to find PlaceId offset");
             return false;
@@ -63,24 +73,27 @@ namespace scanner::phases {
         offset_registry.add("DataModel", "PlaceId", *place_id);
 
         auto creator_id =
-            memory->find_value_offset<uint64_t>(ctx.data_model, settings::creator_id());
+            ctx.memory->find_value_offset<uint64_t>(ctx.data_model, settings::creator_id(), 0x1000,
+                                                    0x8, 0, {},
+                                                    offset_registry.seed("DataModel", "CreatorId"));
         if (!creator_id) {
             LOG_ERR("Failed to find CreatorId offset");
             return false;
         }
         offset_registry.add("DataModel", "CreatorId", *creator_id);
 
-        const auto job_id = memory->find_string_by_regex(
+        const auto job_id = ctx.memory->find_string_by_regex(
             ctx.data_model, R"([0-9a-f]{8}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{12})",
-            0x200, 0x8, 64);
+            0x200, 0x8, 64, offset_registry.seed("DataModel", "JobId"));
         if (!job_id) {
             LOG_ERR("Failed to find JobId offset");
             return false;
         }
         offset_registry.add("DataModel", "JobId", *job_id);
 
-        const auto ip_address = memory->find_string_by_regex(
-            ctx.data_model, R"(\d+\.\d+\.\d+\.\d+\|\d+)", 0x600, 0x8, 32);
+        const auto ip_address = ctx.memory->find_string_by_regex(
+            ctx.data_model, R"(\d+\.\d+\.\d+\.\d+\|\d+)", 0x600, 0x8, 32,
+            offset_registry.seed("DataModel", "ServerIP"));
         if (!ip_address) {
             LOG_ERR("Failed to find Server IP offset");
             return false;
@@ -88,28 +101,36 @@ namespace scanner::phases {
         offset_registry.add("DataModel", "ServerIP", *ip_address);
 
         const auto game_loaded_offset =
-            memory->find_value_offset<uint32_t>(ctx.data_model, 31, 0x1000, 0x4);
+            ctx.memory->find_value_offset<uint32_t>(
+                ctx.data_model, 31, 0x1000, 0x4, 0, {},
+                offset_registry.seed("DataModel", "GameLoaded"));
         if (!game_loaded_offset) {
             LOG_ERR("Failed to find GameLoaded offset.");
         }
 
         offset_registry.add("DataModel", "GameLoaded", *game_loaded_offset);
 
-        auto run_service = memory->find_rtti_offset(ctx.data_model, "RunService@RBX");
+        auto run_service = ctx.memory->find_rtti_offset(
+            ctx.data_model, "RunService@RBX", 0x1000, 0x8,
+            offset_registry.seed("DataModel", "RunService"));
         if (!run_service) {
             LOG_ERR("Failed to find RunService offset");
             return false;
         }
         offset_registry.add("DataModel", "RunService", *run_service);
 
-        auto user_input = memory->find_rtti_offset(ctx.data_model, "UserInputService@RBX");
+        auto user_input = ctx.memory->find_rtti_offset(
+            ctx.data_model, "UserInputService@RBX", 0x1000, 0x8,
+            offset_registry.seed("DataModel", "UserInputService"));
         if (!user_input) {
             LOG_ERR("Failed to find UserInputService offset");
             return false;
         }
         offset_registry.add("DataModel", "UserInputService", *user_input);
 
-        auto replicator = memory->find_rtti_offset(ctx.data_model, "ClientReplicator@Network@RBX");
+        auto replicator = ctx.memory->find_rtti_offset(
+            ctx.data_model, "ClientReplicator@Network@RBX", 0x1000, 0x8,
+            offset_registry.seed("DataModel", "ClientReplicator"));
         if (!replicator) {
             LOG_ERR("Failed to find ClientReplicator offset");
             return false;
@@ -10,7 +10,8 @@
 namespace scanner::phases {
 
     inline bool depth_of_field_effect(Context& ctx) {
-        const auto lighting = sdk::instance_t(ctx.data_model).find_first_child("Lighting");
+        const auto lighting =
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("Lighting");
         if (!lighting.is_valid()) {
             LOG_ERR("Failed to find Lighting");
             return false;
@@ -23,7 +24,9 @@ namespace scanner::phases {
         }
 
         const auto far_intensity_offset =
-            memory->find_verified_offset_float({depth_of_field.address}, {0.138f}, 0x1000, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {depth_of_field.address}, {0.138f}, 0x1000, 0x2, 0.01f,
+                offset_registry.seed("DepthOfFieldEffect", "Density"));
 
         if (!far_intensity_offset) {
             LOG_ERR("Failed to find FarIntensity offset in DepthOfField");
@@ -33,7 +36,9 @@ namespace scanner::phases {
         offset_registry.add("DepthOfFieldEffect", "Density", *far_intensity_offset);
 
         const auto focus_distance_offset =
-            memory->find_verified_offset_float({depth_of_field.address}, {131.62f}, 0x1000, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {depth_of_field.address}, {131.62f}, 0x1000, 0x2, 0.01f,
+                offset_registry.seed("DepthOfFieldEffect", "FocusDistance"));
 
         if (!focus_distance_offset) {
             LOG_ERR("Failed to find FocusDistance offset in DepthOfField");
@@ -43,7 +48,9 @@ namespace scanner::phases {
         offset_registry.add("DepthOfFieldEffect", "FocusDistance", *focus_distance_offset);
 
         const auto in_focus_radius_offset =
-            memory->find_verified_offset_float({depth_of_field.address}, {21.58f}, 0x1000, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {depth_of_field.address}, {21.58f}, 0x1000, 0x2, 0.01f,
+                offset_registry.seed("DepthOfFieldEffect", "InFocusRadius"));
 
         if (!in_focus_radius_offset) {
             LOG_ERR("Failed to find InFocusRadius offset in DepthOfField");
@@ -53,7 +60,9 @@ namespace scanner::phases {
         offset_registry.add("DepthOfFieldEffect", "InFocusRadius", *in_focus_radius_offset);
 
         const auto near_intensity_offset =
-            memory->find_verified_offset_float({depth_of_field.address}, {0.91f}, 0x1000, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {depth_of_field.address}, {0.91f}, 0x1000, 0x2, 0.01f,
+                offset_registry.seed("DepthOfFieldEffect", "NearIntensity"));
 
         if (!near_intensity_offset) {
             LOG_ERR("Failed to find NearIntensity offset in DepthOfField");
@@ -12,7 +12,7 @@ namespace scanner::phases {
 
     inline bool gui_object(Context& ctx) {
         const auto replicated_storage =
-            sdk::instance_t(ctx.data_model).find_first_child("ReplicatedStorage");
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("ReplicatedStorage");
         if (!replicated_storage.is_valid()) {
             LOG_ERR("Failed to find ReplicatedStorage");
             return false;
@@ -31,7 +31,9 @@ namespace scanner::phases {
         }
 
         const auto anchor_point_offset =
-            memory->find_verified_offset_float({frame.address}, {0.69f}, 0x800, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {frame.address}, {0.69f}, 0x800, 0x2, 0.01f,
+                offset_registry.seed("GuiObject", "AnchorPoint"));
 
         if (!anchor_point_offset) {
             LOG_ERR("Failed to find AnchorPoint offset for GuiObject");
@@ -41,7 +43,9 @@ namespace scanner::phases {
         offset_registry.add("GuiObject", "AnchorPoint", *anchor_point_offset);
 
         const auto bg_transparency_offset =
-            memory->find_verified_offset_float({frame.address}, {0.139f}, 0x800, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {frame.address}, {0.139f}, 0x800, 0x2, 0.01f,
+                offset_registry.seed("GuiObject", "BackgroundTransparency"));
 
         if (!bg_transparency_offset) {
             LOG_ERR("Failed to find BackgroundTransparency offset for GuiObject");
@@ -51,7 +55,9 @@ namespace scanner::phases {
         offset_registry.add("GuiObject", "BackgroundTransparency", *bg_transparency_offset);
 
         const auto border_size_pixel_offset =
-            memory->find_value_offset<uint32_t>(frame.address, 42, 0x800, 0x4);
+            ctx.memory->find_value_offset<uint32_t>(
+                frame.address, 42, 0x800, 0x4, 0, {},
+                offset_registry.seed("GuiObject", "BorderSizePixel"));
 
         if (!border_size_pixel_offset) {
             LOG_ERR("Failed to find BorderSizePixel offset for GuiObject");
@@ -61,7 +67,9 @@ namespace scanner::phases {
         offset_registry.add("GuiObject", "BorderSizePixel", *border_size_pixel_offset);
 
         const auto layout_order_offset =
-            memory->find_value_offset<uint32_t>(frame.address, 107, 0x800, 0x4);
+            ctx.memory->find_value_offset<uint32_t>(
+                frame.address, 107, 0x800, 0x4, 0, {},
+                offset_registry.seed("GuiObject", "LayoutOrder"));
 
         if (!layout_order_offset) {
             LOG_ERR("Failed to find LayoutOrder offset for GuiObject");
@@ -71,7 +79,8 @@ namespace scanner::phases {
         offset_registry.add("GuiObject", "LayoutOrder", *layout_order_offset);
 
         const auto rotation_offset =
-            memory->find_verified_offset_float({frame.address}, {85.2f}, 0x800, 0x2);
+            ctx.memory->find_verified_offset_float({frame.address}, {85.2f}, 0x800, 0x2, 0.01f,
+                                                   offset_registry.seed("GuiObject", "Rotation"));
 
         if (!rotation_offset) {
             LOG_ERR("Failed to find Rotation offset for GuiObject");
@@ -81,7 +90,8 @@ namespace scanner::phases {
         offset_registry.add("GuiObject", "Rotation", *rotation_offset);
 
         const auto zindex_offset =
-            memory->find_value_offset<uint32_t>(frame.address, 39, 0x800, 0x4);
+            ctx.memory->find_value_offset<uint32_t>(frame.address, 39, 0x800, 0x4, 0, {},
+                                                    offset_registry.seed("GuiObject", "ZIndex"));
 
         if (!zindex_offset) {
             LOG_ERR("Failed to find ZIndex offset for GuiObject");
@@ -95,11 +105,13 @@ namespace scanner::phases {
         constexpr float BG_COLOR_B = 60.0f / 255.0f;
 
         auto bg_color_offset =
-            memory->find_verified_offset_float({frame.address}, {BG_COLOR_R}, 0x800, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {frame.address}, {BG_COLOR_R}, 0x800, 0x4, 0.01f,
+                offset_registry.seed("GuiObject", "BackgroundColor3"));
 
         if (bg_color_offset) {
-            float g = memory->read<float>(frame.address + *bg_color_offset + 4);
-            float b = memory->read<float>(frame.address + *bg_color_offset + 8);
+            float g = ctx.memory->read<float>(frame.address + *bg_color_offset + 4);
+            float b = ctx.memory->read<float>(frame.address + *bg_color_offset + 8);
             if (std::abs(g - BG_COLOR_G) < 0.01f && std::abs(b - BG_COLOR_B) < 0.01f) {
                 offset_registry.add("GuiObject", "BackgroundColor3", *bg_color_offset);
             } else {
@@ -114,11 +126,13 @@ namespace scanner::phases {
         constexpr float BORDER_COLOR_B = 219.0f / 255.0f;
 
         auto border_color_offset =
-            memory->find_verified_offset_float({frame.address}, {BORDER_COLOR_R}, 0x800, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {frame.address}, {BORDER_COLOR_R}, 0x800, 0x4, 0.01f,
+                offset_registry.seed("GuiObject", "BorderColor3"));
 
         if (border_color_offset) {
-            float g = memory->read<float>(frame.address + *border_color_offset + 4);
-            float b = memory->read<float>(frame.address + *border_color_offset + 8);
+            float g = ctx.memory->read<float>(frame.address + *border_color_offset + 4);
+            float b = ctx.memory->read<float>(frame.address + *border_color_offset + 8);
             if (std::abs(g - BORDER_COLOR_G) < 0.01f && std::abs(b - BORDER_COLOR_B) < 0.01f) {
                 offset_registry.add("GuiObject", "BorderColor3", *border_color_offset);
             } else {
@@ -128,27 +142,47 @@ namespace scanner::phases {
             LOG_ERR("Failed to find BorderColor3 offset for GuiObject");
         }
 
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
+
+        std::vector<UDim2> positions = {
+            {{0.1f, 10}, {0.2f, 20}},
+            {{0.5f, 50}, {0.6f, 60}},
+            {{0.3f, 30}, {0.4f, 40}},
+        };
+        std::vector<UDim2> sizes = {
+            {{0.25f, 100}, {0.35f, 150}},
+            {{0.75f, 300}, {0.85f, 400}},
+            {{0.45f, 200}, {0.55f, 250}},
+        };
+        std::vector<uint8_t> visible_values = {1, 0, 1, 0};
 
+        // the three scans below touch independent properties, so put the frame in its starting
+        // layout with all three commands in flight and a single settle wait
         {
-            std::vector<UDim2> positions = {
-                {{0.1f, 10}, {0.2f, 20}},
-                {{0.5f, 50}, {0.6f, 60}},
-                {{0.3f, 30}, {0.4f, 40}},
+            auto udim2 = [](const UDim2& value) {
+                return nlohmann::json{{"x_scale", value.X.Scale},
+                                      {"x_offset", value.X.Offset},
+                                      {"y_scale", value.Y.Scale},
+                                      {"y_offset", value.Y.Offset}};
             };
-
-            controller.set_frame_position(positions[0].X.Scale, positions[0].X.Offset,
-                                          positions[0].Y.Scale, positions[0].Y.Offset);
+            if (!control::Controller::wait_all({
+                    controller.execute_async("set_frame_position", udim2(positions[0])),
+                    controller.execute_async("set_frame_size", udim2(sizes[0])),
+                    controller.execute_async("set_frame_visible", {{"value", true}}),
+                })) {
+                LOG_WARN("Failed to reset the Frame layout before scanning");
+            }
             std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        }
 
-            auto offsets = memory->find_offsets_with_snapshots<UDim2>(
+        {
+            auto offsets = ctx.memory->find_offsets_with_snapshots<UDim2>(
                 frame.address, positions,
                 [&](size_t i) {
                     controller.set_frame_position(positions[i].X.Scale, positions[i].X.Offset,
                                                   positions[i].Y.Scale, positions[i].Y.Offset);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(500));
                 },
-                0x800, 0x4);
+                0x800, 0x4, 1000, offset_registry.seed("GuiObject", "Position"));
 
             if (!offsets.empty()) {
                 offset_registry.add("GuiObject", "Position", offsets[0]);
@@ -158,24 +192,13 @@ namespace scanner::phases {
         }
 
         {
-            std::vector<UDim2> sizes = {
-                {{0.25f, 100}, {0.35f, 150}},
-                {{0.75f, 300}, {0.85f, 400}},
-                {{0.45f, 200}, {0.55f, 250}},
-            };
-
-            controller.set_frame_size(sizes[0].X.Scale, sizes[0].X.Offset, sizes[0].Y.Scale,
-                                      sizes[0].Y.Offset);
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
-
-            auto offsets = memory->find_offsets_with_snapshots<UDim2>(
+            auto offsets = ctx.memory->find_offsets_with_snapshots<UDim2>(
                 frame.address, sizes,
                 [&](size_t i) {
                     controller.set_frame_size(sizes[i].X.Scale, sizes[i].X.Offset, sizes[i].Y.Scale,
                                               sizes[i].Y.Offset);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(500));
                 },
-                0x800, 0x4);
+                0x800, 0x4, 1000, offset_registry.seed("GuiObject", "Size"));
 
             if (!offsets.empty()) {
                 offset_registry.add("GuiObject", "Size", offsets[0]);
@@ -189,17 +212,12 @@ namespace scanner::phases {
 
         constexpr int PROP_SLEEP_MS = 200;
 
-        controller.set_frame_visible(true);
-        std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
-
-        std::vector<uint8_t> visible_values = {1, 0, 1, 0};
-        auto visible_offsets = memory->find_offsets_with_snapshots<uint8_t>(
+        auto visible_offsets = ctx.memory->find_offsets_with_snapshots<uint8_t>(
             frame.address, visible_values,
             [&](size_t i) {
                 controller.set_frame_visible(visible_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
             },
-            0x800, 0x1);
+            0x800, 0x1, PROP_SLEEP_MS + 500, offset_registry.seed("GuiObject", "Visible"));
 
         if (visible_offsets.empty()) {
             LOG_ERR("Failed to find Visible offset for GuiObject");
@@ -210,7 +228,8 @@ namespace scanner::phases {
 
        LOG_INFO("Scanning for AbsolutePosition/AbsoluteSize...");
 
-        const auto starter_gui = sdk::instance_t(ctx.data_model).find_first_child("StarterGui");
+        const auto starter_gui =
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("StarterGui");
         if (!starter_gui.is_valid()) {
             LOG_ERR("Failed to find StarterGui");
             return false;
@@ -247,10 +266,10 @@ namespace scanner::phases {
 
         std::optional<size_t> abs_pos_x_offset;
         for (size_t offset = 0; offset < GUI_SCAN_RANGE; offset += 4) {
-            float value = memory->read<float>(hello_frame.address + offset);
+            float value = ctx.memory->read<float>(hello_frame.address + offset);
             if (std::abs(value - abs_info->abs_pos_x) < TOLERANCE) {
                 abs_pos_x_offset = offset;
-                float y_value = memory->read<float>(hello_frame.address + offset + 4);
+                float y_value = ctx.memory->read<float>(hello_frame.address + offset + 4);
                 LOG_INFO("Found AbsolutePosition at 0x{:X} (X={}, Y={})", offset, value, y_value);
                 break;
             }
@@ -258,10 +277,10 @@ namespace scanner::phases {
 
         std::optional<size_t> abs_size_x_offset;
         for (size_t offset = 0; offset < GUI_SCAN_RANGE; offset += 4) {
-            float value = memory->read<float>(hello_frame.address + offset);
+            float value = ctx.memory->read<float>(hello_frame.address + offset);
             if (std::abs(value - abs_info->abs_size_x) < TOLERANCE) {
                 abs_size_x_offset = offset;
-                float y_value = memory->read<float>(hello_frame.address + offset + 4);
+                float y_value = ctx.memory->read<float>(hello_frame.address + offset + 4);
                 LOG_INFO("Found AbsoluteSize at 0x{:X} (X={}, Y={})", offset, value, y_value);
                 break;
             }
@@ -3,6 +3,7 @@
 #include "memory/memory.h"
 #include "scanner.hpp"
 #include "sdk/instance.hpp"
+#include "sweep.hpp"
 #include "utils/offset_registry.hpp"
 #include "utils/structs.h"
 #include <chrono>
@@ -12,7 +13,7 @@ namespace scanner::phases {
 
     inline bool highlight(Context& ctx) {
         const auto replicated_storage =
-            sdk::instance_t(ctx.data_model).find_first_child("ReplicatedStorage");
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("ReplicatedStorage");
         if (!replicated_storage.is_valid()) {
             LOG_ERR("Failed to find ReplicatedStorage");
             return false;
@@ -25,7 +26,9 @@ namespace scanner::phases {
         }
 
         const auto fill_transparency_offset =
-            memory->find_verified_offset_float({highlight.address}, {0.456f}, 0x800, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {highlight.address}, {0.456f}, 0x800, 0x4, 0.01f,
+                offset_registry.seed("Highlight", "FillTransparency"));
 
         if (!fill_transparency_offset) {
             LOG_ERR("Failed to find FillTransparency offset for Highlight");
@@ -35,7 +38,9 @@ namespace scanner::phases {
         offset_registry.add("Highlight", "FillTransparency", *fill_transparency_offset);
 
         const auto outline_transparency_offset =
-            memory->find_verified_offset_float({highlight.address}, {0.652f}, 0x800, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {highlight.address}, {0.652f}, 0x800, 0x4, 0.01f,
+                offset_registry.seed("Highlight", "OutlineTransparency"));
 
         if (!outline_transparency_offset) {
             LOG_ERR("Failed to find OutlineTransparency offset for Highlight");
@@ -49,11 +54,13 @@ namespace scanner::phases {
         constexpr float FILL_COLOR_B = 27.0f / 255.0f;
 
         auto fill_color_offset =
-            memory->find_verified_offset_float({highlight.address}, {FILL_COLOR_R}, 0x800, 0x4);
+            ctx.memory->find_verified_offset_float({highlight.address}, {FILL_COLOR_R}, 0x800, 0x4,
+                                                   0.01f,
+                                                   offset_registry.seed("Highlight", "FillColor"));
 
         if (fill_color_offset) {
-            float g = memory->read<float>(highlight.address + *fill_color_offset + 4);
-            float b = memory->read<float>(highlight.address + *fill_color_offset + 8);
+            float g = ctx.memory->read<float>(highlight.address + *fill_color_offset + 4);
+            float b = ctx.memory->read<float>(highlight.address + *fill_color_offset + 8);
             if (std::abs(g - FILL_COLOR_G) < 0.01f && std::abs(b - FILL_COLOR_B) < 0.01f) {
                 offset_registry.add("Highlight", "FillColor", *fill_color_offset);
             } else {
@@ -68,11 +75,13 @@ namespace scanner::phases {
         constexpr float OUTLINE_COLOR_B = 211.0f / 255.0f;
 
         auto outline_color_offset =
-            memory->find_verified_offset_float({highlight.address}, {OUTLINE_COLOR_R}, 0x800, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {highlight.address}, {OUTLINE_COLOR_R}, 0x800, 0x4, 0.01f,
+                offset_registry.seed("Highlight", "OutlineColor"));
 
         if (outline_color_offset) {
-            float g = memory->read<float>(highlight.address + *outline_color_offset + 4);
-            float b = memory->read<float>(highlight.address + *outline_color_offset + 8);
+            float g = ctx.memory->read<float>(highlight.address + *outline_color_offset + 4);
+            float b = ctx.memory->read<float>(highlight.address + *outline_color_offset + 8);
             if (std::abs(g - OUTLINE_COLOR_G) < 0.01f && std::abs(b - OUTLINE_COLOR_B) < 0.01f) {
                 offset_registry.add("Highlight", "OutlineColor", *outline_color_offset);
             } else {
@@ -82,20 +91,36 @@ namespace scanner::phases {
             LOG_ERR("Failed to find OutlineColor offset for Highlight");
         }
 
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
         constexpr int SLEEP_MS = 200;
 
         controller.set_highlight_depth_mode(0);
         std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
 
-        std::vector<int32_t> depth_mode_values = {0, 1, 0};
-        auto depth_mode_offsets = memory->find_offsets_with_snapshots<int32_t>(
-            highlight.address, depth_mode_values,
-            [&](size_t i) {
-                controller.set_highlight_depth_mode(depth_mode_values[i]);
-                std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
-            },
-            0x800, 0x4, SLEEP_MS);
+        // one value per frame in lockstep; the round-trip scan is only the fallback
+        std::vector<int32_t> sweep_values = {1, 0, 1, 0, 1, 0};
+        std::vector<nlohmann::json> sweep_steps;
+        for (int32_t value : sweep_values)
+            sweep_steps.push_back({{"value", value}});
+
+        auto depth_mode_offsets =
+            sweep_offsets<int32_t>(ctx, highlight.address, "set_highlight_depth_mode", sweep_steps,
+                                   sweep_values, 0x800, 0x4,
+                                   offset_registry.seed("Highlight", "DepthMode"))
+                .value_or(std::vector<size_t>{});
+
+        if (depth_mode_offsets.empty()) {
+            controller.set_highlight_depth_mode(0);
+            std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
+
+            std::vector<int32_t> depth_mode_values = {0, 1, 0};
+            depth_mode_offsets = ctx.memory->find_offsets_with_snapshots<int32_t>(
+                highlight.address, depth_mode_values,
+                [&](size_t i) {
+                    controller.set_highlight_depth_mode(depth_mode_values[i]);
+                },
+                0x800, 0x4, 2 * SLEEP_MS, offset_registry.seed("Highlight", "DepthMode"));
+        }
 
         if (!depth_mode_offsets.empty()) {
             offset_registry.add("Highlight", "DepthMode", depth_mode_offsets[0]);
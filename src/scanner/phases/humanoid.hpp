@@ -1,5 +1,6 @@
 #pragma once
 #include "control/control.hpp"
+#include "flag_probe.hpp"
 #include "memory/memory.h"
 #include "scanner.hpp"
 #include "utils/offset_registry.hpp"
@@ -9,7 +10,7 @@
 namespace scanner::phases {
 
     inline bool humanoid(Context& ctx) {
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
 
         if (!ctx.workspace.is_valid()) {
             LOG_ERR("Workspace not valid");
@@ -69,9 +70,10 @@ namespace scanner::phases {
         constexpr size_t SCAN_RANGE = 0x800;
         constexpr size_t ALIGNMENT = 0x4;
 
-        auto health_display_dist_offset = memory->find_verified_offset_float(
+        auto health_display_dist_offset = ctx.memory->find_verified_offset_float(
             {humanoid1.address, humanoid2.address},
-            {CHAR1_HEALTH_DISPLAY_DIST, CHAR2_HEALTH_DISPLAY_DIST}, SCAN_RANGE, ALIGNMENT);
+            {CHAR1_HEALTH_DISPLAY_DIST, CHAR2_HEALTH_DISPLAY_DIST}, SCAN_RANGE, ALIGNMENT, 0.01f,
+            offset_registry.seed("Humanoid", "HealthDisplayDistance"));
 
         if (!health_display_dist_offset) {
             LOG_ERR("Failed to find HealthDisplayDistance offset");
@@ -79,9 +81,10 @@ namespace scanner::phases {
         }
         offset_registry.add("Humanoid", "HealthDisplayDistance", *health_display_dist_offset);
 
-        auto name_display_dist_offset = memory->find_verified_offset_float(
+        auto name_display_dist_offset = ctx.memory->find_verified_offset_float(
             {humanoid1.address, humanoid2.address},
-            {CHAR1_NAME_DISPLAY_DIST, CHAR2_NAME_DISPLAY_DIST}, SCAN_RANGE, ALIGNMENT);
+            {CHAR1_NAME_DISPLAY_DIST, CHAR2_NAME_DISPLAY_DIST}, SCAN_RANGE, ALIGNMENT, 0.01f,
+            offset_registry.seed("Humanoid", "NameDisplayDistance"));
 
         if (!name_display_dist_offset) {
             LOG_ERR("Failed to find NameDisplayDistance offset");
@@ -90,8 +93,10 @@ namespace scanner::phases {
         offset_registry.add("Humanoid", "NameDisplayDistance", *name_display_dist_offset);
 
         auto health_offset =
-            memory->find_verified_offset_float({humanoid1.address, humanoid2.address},
-                                               {CHAR1_HEALTH, CHAR2_HEALTH}, SCAN_RANGE, ALIGNMENT);
+            ctx.memory->find_verified_offset_float({humanoid1.address, humanoid2.address},
+                                                   {CHAR1_HEALTH, CHAR2_HEALTH}, SCAN_RANGE,
+                                                   ALIGNMENT, 0.01f,
+                                                   offset_registry.seed("Humanoid", "Health"));
 
         if (!health_offset) {
             LOG_ERR("Failed to find Health offset");
@@ -99,9 +104,9 @@ namespace scanner::phases {
         }
         offset_registry.add("Humanoid", "Health", *health_offset);
 
-        auto max_health_offset = memory->find_verified_offset_float(
+        auto max_health_offset = ctx.memory->find_verified_offset_float(
             {humanoid1.address, humanoid2.address}, {CHAR1_MAX_HEALTH, CHAR2_MAX_HEALTH},
-            SCAN_RANGE, ALIGNMENT);
+            SCAN_RANGE, ALIGNMENT, 0.01f, offset_registry.seed("Humanoid", "MaxHealth"));
 
         if (!max_health_offset) {
             LOG_ERR("Failed to find MaxHealth offset");
@@ -109,9 +114,9 @@ namespace scanner::phases {
         }
         offset_registry.add("Humanoid", "MaxHealth", *max_health_offset);
 
-        auto hip_height_offset = memory->find_verified_offset_float(
+        auto hip_height_offset = ctx.memory->find_verified_offset_float(
             {humanoid1.address, humanoid2.address}, {CHAR1_HIP_HEIGHT, CHAR2_HIP_HEIGHT},
-            SCAN_RANGE, ALIGNMENT);
+            SCAN_RANGE, ALIGNMENT, 0.01f, offset_registry.seed("Humanoid", "HipHeight"));
 
         if (!hip_height_offset) {
             LOG_ERR("Failed to find HipHeight offset");
@@ -119,9 +124,9 @@ namespace scanner::phases {
         }
         offset_registry.add("Humanoid", "HipHeight", *hip_height_offset);
 
-        auto jump_power_offset = memory->find_verified_offset_float(
+        auto jump_power_offset = ctx.memory->find_verified_offset_float(
             {humanoid1.address, humanoid2.address}, {CHAR1_JUMP_POWER, CHAR2_JUMP_POWER},
-            SCAN_RANGE, ALIGNMENT);
+            SCAN_RANGE, ALIGNMENT, 0.01f, offset_registry.seed("Humanoid", "JumpPower"));
 
         if (!jump_power_offset) {
             LOG_ERR("Failed to find JumpPower offset");
@@ -129,9 +134,9 @@ namespace scanner::phases {
         }
         offset_registry.add("Humanoid", "JumpPower", *jump_power_offset);
 
-        auto jump_height_offset = memory->find_verified_offset_float(
+        auto jump_height_offset = ctx.memory->find_verified_offset_float(
             {humanoid1.address, humanoid2.address}, {CHAR1_JUMP_HEIGHT, CHAR2_JUMP_HEIGHT},
-            SCAN_RANGE, ALIGNMENT);
+            SCAN_RANGE, ALIGNMENT, 0.01f, offset_registry.seed("Humanoid", "JumpHeight"));
 
         if (!jump_height_offset) {
             LOG_ERR("Failed to find JumpHeight offset");
@@ -139,9 +144,9 @@ namespace scanner::phases {
         }
         offset_registry.add("Humanoid", "JumpHeight", *jump_height_offset);
 
-        auto walkspeed_offset = memory->find_verified_offset_float(
+        auto walkspeed_offset = ctx.memory->find_verified_offset_float(
             {humanoid1.address, humanoid2.address}, {CHAR1_WALK_SPEED, CHAR2_WALK_SPEED},
-            SCAN_RANGE, ALIGNMENT);
+            SCAN_RANGE, ALIGNMENT, 0.01f, offset_registry.seed("Humanoid", "WalkSpeed"));
 
         if (!walkspeed_offset) {
             LOG_ERR("Failed to find WalkSpeed offset");
@@ -149,28 +154,24 @@ namespace scanner::phases {
         }
         offset_registry.add("Humanoid", "WalkSpeed", *walkspeed_offset);
 
-        bool found_walkspeed_check = false;
-        for (size_t offset = *walkspeed_offset + ALIGNMENT; offset < SCAN_RANGE;
-             offset += ALIGNMENT) {
-            float value1 = memory->read<float>(humanoid1.address + offset);
-            float value2 = memory->read<float>(humanoid2.address + offset);
+        // WalkSpeedCheck mirrors WalkSpeed somewhere after it, so the window starts right past
+        // WalkSpeed and is probed outward from the seeded offset, or from its start if unseeded
+        const size_t check_start = *walkspeed_offset + ALIGNMENT;
+        const auto check_seed = offset_registry.seed("Humanoid", "WalkSpeedCheck");
+        auto walkspeed_check_offset = ctx.memory->find_verified_offset_float(
+            {humanoid1.address + check_start, humanoid2.address + check_start},
+            {CHAR1_WALK_SPEED, CHAR2_WALK_SPEED}, SCAN_RANGE - check_start, ALIGNMENT, 0.01f,
+            check_seed && *check_seed >= check_start ? *check_seed - check_start : 0);
 
-            if (std::abs(value1 - CHAR1_WALK_SPEED) < 0.01f &&
-                std::abs(value2 - CHAR2_WALK_SPEED) < 0.01f) {
-                offset_registry.add("Humanoid", "WalkSpeedCheck", offset);
-                found_walkspeed_check = true;
-                break;
-            }
-        }
-
-        if (!found_walkspeed_check) {
+        if (!walkspeed_check_offset) {
             LOG_ERR("Failed to find WalkSpeedCheck offset");
             return false;
         }
+        offset_registry.add("Humanoid", "WalkSpeedCheck", check_start + *walkspeed_check_offset);
 
-        auto rig_type_offset = memory->find_verified_offset<uint8_t>(
+        auto rig_type_offset = ctx.memory->find_verified_offset<uint8_t>(
             {humanoid1.address, humanoid2.address}, {CHAR1_RIG_TYPE, CHAR2_RIG_TYPE}, SCAN_RANGE,
-            0x1);
+            0x1, offset_registry.seed("Humanoid", "RigType"));
 
         if (!rig_type_offset) {
             LOG_ERR("Failed to find RigType offset");
@@ -178,9 +179,9 @@ namespace scanner::phases {
         }
         offset_registry.add("Humanoid", "RigType", *rig_type_offset);
 
-        const auto max_slope_offset = memory->find_verified_offset_float(
+        const auto max_slope_offset = ctx.memory->find_verified_offset_float(
             {humanoid1.address, humanoid2.address}, {CHAR1_MAX_SLOPE_ANGLE, CHAR2_MAX_SLOPE_ANGLE},
-            SCAN_RANGE, ALIGNMENT);
+            SCAN_RANGE, ALIGNMENT, 0.01f, offset_registry.seed("Humanoid", "MaxSlopeOffset"));
 
         if (!max_slope_offset) {
             LOG_ERR("Failed to find MaxSlopeOffset offset");
@@ -206,26 +207,28 @@ namespace scanner::phases {
             return false;
         }
 
-        auto head_primitive_offset = memory->find_rtti_offset(head.address, "Primitive@RBX");
+        auto head_primitive_offset = ctx.memory->find_rtti_offset(head.address, "Primitive@RBX");
         if (!head_primitive_offset) {
             LOG_ERR("Failed to find Primitive in Head");
             return false;
         }
 
-        auto head_primitive = memory->read<uintptr_t>(head.address + *head_primitive_offset);
+        auto head_primitive = ctx.memory->read<uintptr_t>(head.address + *head_primitive_offset);
         if (!head_primitive) {
             LOG_ERR("Failed to read Head Primitive pointer");
             return false;
         }
 
+        // the NPC only starts or stops walking once physics has stepped, so every step gets at
+        // least this long before the candidates are filtered
+        constexpr int WALKING_MIN_WAIT_MS = 1000;
         std::vector<uint8_t> walking_values = {0, 1, 0, 1};
-        auto walking_offsets = memory->find_offsets_with_snapshots<uint8_t>(
+        auto walking_offsets = ctx.memory->find_offsets_with_snapshots<uint8_t>(
             npc_humanoid.address, walking_values,
             [&](size_t i) {
                 controller.set_npc_move_to(walking_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
             },
-            0xA00, 0x1);
+            0xA00, 0x1, 1500, offset_registry.seed("Humanoid", "IsWalking"), WALKING_MIN_WAIT_MS);
 
         if (walking_offsets.empty()) {
             LOG_ERR("Failed to find IsWalking offset");
@@ -245,7 +248,8 @@ namespace scanner::phases {
         std::this_thread::sleep_for(std::chrono::milliseconds(3000));
 
         auto velocity_offset =
-            memory->find_vector3_offset({head_primitive}, {{-0.011f, 0.0f, -2.0f}}, 0x600, 1.0f);
+            ctx.memory->find_vector3_offset({head_primitive}, {{-0.011f, 0.0f, -2.0f}}, 0x600, 1.0f,
+                                            offset_registry.seed("Part", "AssemblyLinearVelocity"));
 
         if (!velocity_offset) {
             LOG_ERR("Failed to find AssemblyLinearVelocity offset");
@@ -254,8 +258,9 @@ namespace scanner::phases {
         offset_registry.add("Part", "AssemblyLinearVelocity", *velocity_offset);
         offset_registry.add("Part", "AssemblyAngularVelocity", *velocity_offset + 12);
 
-        auto walkto_offset = memory->find_vector3_offset(
-            {npc_humanoid.address}, {{-41.001f, 0.5f, -728.995f}}, 0x600, 5.0f);
+        auto walkto_offset = ctx.memory->find_vector3_offset(
+            {npc_humanoid.address}, {{-41.001f, 0.5f, -728.995f}}, 0x600, 5.0f,
+            offset_registry.seed("Humanoid", "WalkToPoint"));
 
         if (!walkto_offset) {
             LOG_ERR("Failed to find WalkToPoint offset");
@@ -267,106 +272,43 @@ namespace scanner::phases {
 
         constexpr int PROP_SLEEP_MS = 150; 
 
-        LOG_INFO("Scanning for AutoRotate...");
-        controller.set_npc_auto_rotate(false);
-        std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
-
-        std::vector<uint8_t> auto_rotate_values = {0, 1, 0, 1};
-        auto auto_rotate_offsets = memory->find_offsets_with_snapshots<uint8_t>(
-            npc_humanoid.address, auto_rotate_values,
-            [&](size_t i) {
-                controller.set_npc_auto_rotate(auto_rotate_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
-            },
-            SCAN_RANGE, 0x1);
-
-        if (auto_rotate_offsets.empty()) {
-            LOG_ERR("Failed to find AutoRotate offset");
-            return false;
-        }
-        offset_registry.add("Humanoid", "AutoRotate", auto_rotate_offsets[0]);
-
-        LOG_INFO("Scanning for AutoJumpEnabled...");
-        controller.set_npc_auto_jump_enabled(true);
-        std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
-
-        std::vector<uint8_t> auto_jump_values = {1, 0, 1, 0};
-        auto auto_jump_offsets = memory->find_offsets_with_snapshots<uint8_t>(
-            npc_humanoid.address, auto_jump_values,
-            [&](size_t i) {
-                controller.set_npc_auto_jump_enabled(auto_jump_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
-            },
-            SCAN_RANGE, 0x1);
-
-        if (auto_jump_offsets.empty()) {
-            LOG_ERR("Failed to find AutoJumpEnabled offset");
-            return false;
-        }
-        offset_registry.add("Humanoid", "AutoJumpEnabled", auto_jump_offsets[0]);
-
-        LOG_INFO("Scanning for BreakJointsOnDeath...");
-        controller.set_npc_break_joints_on_death(true);
-        std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
-
-        std::vector<uint8_t> break_joints_values = {1, 0, 1, 0};
-        auto break_joints_offsets = memory->find_offsets_with_snapshots<uint8_t>(
-            npc_humanoid.address, break_joints_values,
-            [&](size_t i) {
-                controller.set_npc_break_joints_on_death(break_joints_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
-            },
-            SCAN_RANGE, 0x1);
-
-        if (break_joints_offsets.empty()) {
-            LOG_ERR("Failed to find BreakJointsOnDeath offset");
-            return false;
-        }
-        offset_registry.add("Humanoid", "BreakJointsOnDeath", break_joints_offsets[0]);
-
-        LOG_INFO("Scanning for RequiresNeck...");
-        controller.set_npc_requires_neck(true);
-        std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
-
-        std::vector<uint8_t> requires_neck_values = {1, 0, 1, 0};
-        auto requires_neck_offsets = memory->find_offsets_with_snapshots<uint8_t>(
-            npc_humanoid.address, requires_neck_values,
-            [&](size_t i) {
-                controller.set_npc_requires_neck(requires_neck_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
-            },
-            SCAN_RANGE, 0x1);
-
-        if (requires_neck_offsets.empty()) {
-            LOG_ERR("Failed to find RequiresNeck offset");
-            return false;
-        }
-        offset_registry.add("Humanoid", "RequiresNeck", requires_neck_offsets[0]);
-
-        LOG_INFO("Scanning for UseJumpPower...");
-        controller.set_npc_use_jump_power(true);
-        std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
-
-        std::vector<uint8_t> use_jump_power_values = {1, 0, 1, 0};
-        auto use_jump_power_offsets = memory->find_offsets_with_snapshots<uint8_t>(
-            npc_humanoid.address, use_jump_power_values,
-            [&](size_t i) {
-                controller.set_npc_use_jump_power(use_jump_power_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(PROP_SLEEP_MS));
-            },
-            SCAN_RANGE, 0x1);
-
-        if (use_jump_power_offsets.empty()) {
-            LOG_ERR("Failed to find UseJumpPower offset");
-            return false;
+        LOG_INFO("Scanning for AutoRotate, AutoJumpEnabled, BreakJointsOnDeath, RequiresNeck and "
+                 "UseJumpPower...");
+
+        const std::vector<std::pair<std::string, FlagProbe>> flags = {
+            {"AutoRotate",
+             {"set_npc_auto_rotate", {}, offset_registry.seed("Humanoid", "AutoRotate")}},
+            {"AutoJumpEnabled",
+             {"set_npc_auto_jump_enabled", {},
+              offset_registry.seed("Humanoid", "AutoJumpEnabled")}},
+            {"BreakJointsOnDeath",
+             {"set_npc_break_joints_on_death", {},
+              offset_registry.seed("Humanoid", "BreakJointsOnDeath")}},
+            {"RequiresNeck",
+             {"set_npc_requires_neck", {}, offset_registry.seed("Humanoid", "RequiresNeck")}},
+            {"UseJumpPower",
+             {"set_npc_use_jump_power", {}, offset_registry.seed("Humanoid", "UseJumpPower")}},
+        };
+
+        std::vector<FlagProbe> probes;
+        for (const auto& [name, probe] : flags)
+            probes.push_back(probe);
+
+        auto flag_offsets = find_flag_offsets(*ctx.memory, controller, npc_humanoid.address, probes,
+                                              SCAN_RANGE, PROP_SLEEP_MS);
+        for (size_t i = 0; i < flags.size(); i++) {
+            if (!flag_offsets[i].has_value()) {
+                LOG_ERR("Failed to find {} offset", flags[i].first);
+                return false;
+            }
+            offset_registry.add("Humanoid", flags[i].first, *flag_offsets[i]);
         }
-        offset_registry.add("Humanoid", "UseJumpPower", use_jump_power_offsets[0]);
 
         LOG_INFO("Scanning for Jump (continuous monitoring)...");
 
         std::vector<uint8_t> baseline(SCAN_RANGE);
         for (size_t i = 0; i < SCAN_RANGE; i++) {
-            baseline[i] = memory->read<uint8_t>(npc_humanoid.address + i);
+            baseline[i] = ctx.memory->read<uint8_t>(npc_humanoid.address + i);
         }
 
         std::vector<int> toggle_count(SCAN_RANGE, 0);
@@ -387,7 +329,7 @@ namespace scanner::phases {
                 break;
 
             for (size_t i = 0; i < SCAN_RANGE; i++) {
-                uint8_t current = memory->read<uint8_t>(npc_humanoid.address + i);
+                uint8_t current = ctx.memory->read<uint8_t>(npc_humanoid.address + i);
 
                 if ((last_value[i] == 0 && current == 1) || (last_value[i] == 1 && current == 0)) {
                     toggle_count[i]++;
@@ -405,7 +347,7 @@ namespace scanner::phases {
 
         std::vector<std::pair<size_t, int>> candidates;
         for (size_t i = 0; i < SCAN_RANGE; i++) {
-            uint8_t current = memory->read<uint8_t>(npc_humanoid.address + i);
+            uint8_t current = ctx.memory->read<uint8_t>(npc_humanoid.address + i);
 
             if (toggle_count[i] >= 4 && baseline[i] == 0 && current == 0) {
                 candidates.push_back({i, toggle_count[i]});
@@ -439,8 +381,9 @@ namespace scanner::phases {
         controller.set_npc_move_direction(0, 0, -1);
         std::this_thread::sleep_for(std::chrono::milliseconds(300));
 
-        auto move_direction_offset = memory->find_vector3_offset(
-            {npc_humanoid.address}, {{0.0f, 0.0f, -1.0f}}, SCAN_RANGE, 0.3f);
+        auto move_direction_offset = ctx.memory->find_vector3_offset(
+            {npc_humanoid.address}, {{0.0f, 0.0f, -1.0f}}, SCAN_RANGE, 0.3f,
+            offset_registry.seed("Humanoid", "MoveDirection"));
 
         if (!move_direction_offset) {
             LOG_ERR("Failed to find MoveDirection offset");
@@ -455,7 +398,7 @@ namespace scanner::phases {
         std::this_thread::sleep_for(std::chrono::milliseconds(500)); 
 
         std::vector<uint32_t> floor_values = {256, 512, 256, 512};
-        auto floor_offsets = memory->find_offsets_with_snapshots<uint32_t>(
+        auto floor_offsets = ctx.memory->find_offsets_with_snapshots<uint32_t>(
             npc_humanoid.address, floor_values,
             [&](size_t i) {
                 if (floor_values[i] == 256) {
@@ -463,9 +406,8 @@ namespace scanner::phases {
                 } else {
                     controller.move_npc_to_floor("WoodFloor");
                 }
-                std::this_thread::sleep_for(std::chrono::milliseconds(500)); 
             },
-            SCAN_RANGE, 0x4);
+            SCAN_RANGE, 0x4, 1000, offset_registry.seed("Humanoid", "FloorMaterial"));
 
         if (floor_offsets.empty()) {
             LOG_ERR("Failed to find FloorMaterial offset");
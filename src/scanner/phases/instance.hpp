@@ -6,30 +6,30 @@
 
 namespace scanner::phases {
 
-    std::optional<std::pair<size_t, size_t>> find_children_offsets(uintptr_t instance,
-                                                                   size_t expected_count) {
+    std::optional<std::pair<size_t, size_t>>
+    find_children_offsets(Memory& mem, uintptr_t instance, size_t expected_count) {
         uintptr_t parent_offset = sdk::offsets::Instance::Parent;
 
         for (size_t start_off = 0; start_off < 0x200; start_off += 0x8) {
             if (start_off == parent_offset)
                 continue;
 
-            uintptr_t start_ptr = memory->read<uintptr_t>(instance + start_off);
+            uintptr_t start_ptr = mem.read<uintptr_t>(instance + start_off);
             if (!start_ptr || start_ptr < 0x10000)
                 continue;
 
             for (size_t end_off = 0; end_off < 0x20; end_off += 0x8) {
-                uintptr_t end_ptr = memory->read<uintptr_t>(start_ptr + end_off);
+                uintptr_t end_ptr = mem.read<uintptr_t>(start_ptr + end_off);
                 if (!end_ptr || end_ptr < 0x10000)
                     continue;
 
                 size_t count = 0;
-                uintptr_t node = memory->read<uintptr_t>(start_ptr);
+                uintptr_t node = mem.read<uintptr_t>(start_ptr);
                 for (int i = 0; i < 1000 && node != end_ptr; i++, node += 0x10) {
-                    uintptr_t child = memory->read<uintptr_t>(node);
+                    uintptr_t child = mem.read<uintptr_t>(node);
                     if (!child || child < 0x10000)
                         break;
-                    uintptr_t vtable = memory->read<uintptr_t>(child);
+                    uintptr_t vtable = mem.read<uintptr_t>(child);
                     if (!vtable || vtable < 0x10000)
                         break;
                     count++;
@@ -44,17 +44,17 @@ namespace scanner::phases {
     }
 
     std::optional<std::tuple<size_t, size_t, size_t, size_t>>
-    find_attribute_offsets(uintptr_t instance) {
+    find_attribute_offsets(Memory& mem, uintptr_t instance) {
         size_t iterations = 0;
         constexpr size_t MAX_ITERATIONS = 50000;
 
         for (size_t container_off = 0; container_off < 0x200; container_off += 0x8) {
-            uintptr_t container = memory->read<uintptr_t>(instance + container_off);
+            uintptr_t container = mem.read<uintptr_t>(instance + container_off);
             if (!container || container < 0x10000)
                 continue;
 
             for (size_t list_off = 0; list_off < 0x100; list_off += 0x8) {
-                uintptr_t first_attr = memory->read<uintptr_t>(container + list_off);
+                uintptr_t first_attr = mem.read<uintptr_t>(container + list_off);
                 if (!first_attr || first_attr < 0x10000)
                     continue;
 
@@ -66,7 +66,7 @@ namespace scanner::phases {
                         return std::nullopt;
                     }
 
-                    std::string str = memory->read_roblox_string(first_attr + off);
+                    std::string str = mem.read_roblox_string(first_attr + off);
                     if (str == "hellovalue") {
                         value_off = off;
                         found_value = true;
@@ -90,7 +90,7 @@ namespace scanner::phases {
                     if (test_addr < 0x10000)
                         break;
 
-                    std::string forward = memory->read_roblox_string(test_addr);
+                    std::string forward = mem.read_roblox_string(test_addr);
                     if (forward == "hello2value") {
                         second_attr = first_attr + offset;
                         stride = offset;
@@ -109,9 +109,9 @@ namespace scanner::phases {
 
                     if (off == value_off)
                         continue;
-                    uintptr_t ptr = memory->read<uintptr_t>(first_attr + off);
+                    uintptr_t ptr = mem.read<uintptr_t>(first_attr + off);
                     if (ptr && ptr > 0x10000) {
-                        std::string str = memory->read_roblox_string(ptr);
+                        std::string str = mem.read_roblox_string(ptr);
                         if (str == "hello") {
                             return std::make_tuple(container_off, list_off, stride, value_off);
                         }
@@ -130,41 +130,47 @@ namespace scanner::phases {
         }
 
         auto class_desc =
-            memory->find_rtti_offset(ctx.workspace.address, "ClassDescriptor@Reflection@RBX");
+            ctx.memory->find_rtti_offset(ctx.workspace.address, "ClassDescriptor@Reflection@RBX",
+                                         0x1000, 0x8,
+                                         offset_registry.seed("Instance", "ClassDescriptor"));
         if (!class_desc) {
             LOG_ERR("Failed to find ClassDescriptor offset");
             return false;
         }
         offset_registry.add("Instance", "ClassDescriptor", *class_desc);
 
-        auto workspace_class = memory->read<uintptr_t>(ctx.workspace.address + *class_desc);
+        auto workspace_class = ctx.memory->read<uintptr_t>(ctx.workspace.address + *class_desc);
         if (!workspace_class) {
             LOG_ERR("Failed to read ClassDescriptor pointer");
             return false;
         }
 
-        auto class_name = memory->scan_roblox_string(workspace_class, "Workspace");
+        auto class_name =
+            ctx.memory->scan_roblox_string(workspace_class, "Workspace", 0x200, 0x8,
+                                           offset_registry.seed("Instance", "ClassName"));
         if (!class_name) {
             LOG_ERR("Failed to find ClassName offset");
             return false;
         }
         offset_registry.add("Instance", "ClassName", class_name->pointer_offset);
 
-        auto parent = memory->find_rtti_offset(ctx.workspace.address, "DataModel@RBX");
+        auto parent = ctx.memory->find_rtti_offset(ctx.workspace.address, "DataModel@RBX", 0x1000,
+                                                   0x8, offset_registry.seed("Instance", "Parent"));
         if (!parent) {
             LOG_ERR("Failed to find Parent offset");
             return false;
         }
         offset_registry.add("Instance", "Parent", *parent);
 
-        auto name = memory->scan_roblox_string(ctx.workspace.address, "Workspace");
+        auto name = ctx.memory->scan_roblox_string(ctx.workspace.address, "Workspace", 0x200, 0x8,
+                                                   offset_registry.seed("Instance", "Name"));
         if (!name) {
             LOG_ERR("Failed to find Name offset");
             return false;
         }
         offset_registry.add("Instance", "Name", name->pointer_offset);
 
-        auto children = find_children_offsets(ctx.workspace.address, 24);
+        auto children = find_children_offsets(*ctx.memory, ctx.workspace.address, 24);
         if (!children) {
             LOG_ERR("Failed to find Children offsets");
             return false;
@@ -178,7 +184,7 @@ namespace scanner::phases {
             return false;
         }
 
-        auto attr = find_attribute_offsets(attributes_part.address);
+        auto attr = find_attribute_offsets(*ctx.memory, attributes_part.address);
         if (!attr) {
             LOG_ERR("Failed to find Attribute offsets");
             return false;
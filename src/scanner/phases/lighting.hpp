@@ -10,16 +10,17 @@
 namespace scanner::phases {
 
     inline bool lighting(Context& ctx) {
-        auto lighting = sdk::instance_t(ctx.data_model).find_first_child("Lighting");
+        auto lighting = sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("Lighting");
         if (!lighting.is_valid()) {
             LOG_ERR("Failed to find Lighting");
             return false;
         }
 
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
         constexpr int SLEEP_MS = 500;
 
-        auto sky = memory->find_rtti_offset(lighting.address, "Sky@RBX");
+        auto sky = ctx.memory->find_rtti_offset(lighting.address, "Sky@RBX", 0x1000, 0x8,
+                                                offset_registry.seed("Lighting", "Sky"));
         if (!sky) {
             LOG_ERR("Failed to get Sky pointer inside Lighting");
             return false;
@@ -27,7 +28,9 @@ namespace scanner::phases {
 
         offset_registry.add("Lighting", "Sky", *sky);
 
-        auto atmosphere = memory->find_rtti_offset(lighting.address, "Atmosphere@RBX");
+        auto atmosphere =
+            ctx.memory->find_rtti_offset(lighting.address, "Atmosphere@RBX", 0x1000, 0x8,
+                                         offset_registry.seed("Lighting", "Atmosphere"));
         if (!atmosphere) {
             LOG_ERR("Failed to get Atmosphere pointer inside Lighting");
             return false;
@@ -36,7 +39,8 @@ namespace scanner::phases {
         offset_registry.add("Lighting", "Atmosphere", *atmosphere);
 
         const auto brightness_offset =
-            memory->find_verified_offset_float({lighting.address}, {3.456f}, 0x400, 0x2);
+            ctx.memory->find_verified_offset_float({lighting.address}, {3.456f}, 0x400, 0x2, 0.01f,
+                                                   offset_registry.seed("Lighting", "Brightness"));
 
         if (!brightness_offset) {
             LOG_ERR("Failed to find Brightness offset");
@@ -47,7 +51,9 @@ namespace scanner::phases {
 
         // note for future me if i forget. clock time is stored in microseconds
         const auto clock_time =
-            memory->find_value_offset<uint64_t>(lighting.address, 21600000000, 0x400, 0x4); // 6am
+            ctx.memory->find_value_offset<uint64_t>(
+                lighting.address, 21600000000, 0x400, 0x4, 0, {},
+                offset_registry.seed("Lighting", "ClockTime")); // 6am
 
         if (!clock_time) {
             LOG_ERR("Failed to find ClockTime offset");
@@ -57,7 +63,9 @@ namespace scanner::phases {
         offset_registry.add("Lighting", "ClockTime", *clock_time);
 
         const auto environment_diffuse_scale_offset =
-            memory->find_verified_offset_float({lighting.address}, {0.817f}, 0x400, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {lighting.address}, {0.817f}, 0x400, 0x4, 0.01f,
+                offset_registry.seed("Lighting", "EnvironmentDiffuseScale"));
 
         if (!environment_diffuse_scale_offset) {
             LOG_ERR("Failed to find EnvironmentDiffuseScale offset");
@@ -68,7 +76,9 @@ namespace scanner::phases {
                             *environment_diffuse_scale_offset);
 
         const auto environment_specular_scale_offset =
-            memory->find_verified_offset_float({lighting.address}, {0.521f}, 0x400, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {lighting.address}, {0.521f}, 0x400, 0x4, 0.01f,
+                offset_registry.seed("Lighting", "EnvironmentSpecularScale"));
 
         if (!environment_specular_scale_offset) {
             LOG_ERR("Failed to find EnvironmentSpecularScale offset");
@@ -83,11 +93,13 @@ namespace scanner::phases {
         constexpr float AMBIENT_B = 173.0f / 255.0f;
 
         auto ambient_offset =
-            memory->find_verified_offset_float({lighting.address}, {AMBIENT_R}, 0x600, 0x4);
+            ctx.memory->find_verified_offset_float({lighting.address}, {AMBIENT_R}, 0x600, 0x4,
+                                                   0.01f,
+                                                   offset_registry.seed("Lighting", "Ambient"));
 
         if (ambient_offset) {
-            float g = memory->read<float>(lighting.address + *ambient_offset + 4);
-            float b = memory->read<float>(lighting.address + *ambient_offset + 8);
+            float g = ctx.memory->read<float>(lighting.address + *ambient_offset + 4);
+            float b = ctx.memory->read<float>(lighting.address + *ambient_offset + 8);
             if (std::abs(g - AMBIENT_G) < 0.01f && std::abs(b - AMBIENT_B) < 0.01f) {
                 offset_registry.add("Lighting", "Ambient", *ambient_offset);
             } else {
@@ -103,9 +115,9 @@ namespace scanner::phases {
 
         std::optional<size_t> outdoor_offset;
         for (size_t offset = 0; offset < 0x600; offset += 4) {
-            float r = memory->read<float>(lighting.address + offset);
-            float g = memory->read<float>(lighting.address + offset + 4);
-            float b = memory->read<float>(lighting.address + offset + 8);
+            float r = ctx.memory->read<float>(lighting.address + offset);
+            float g = ctx.memory->read<float>(lighting.address + offset + 4);
+            float b = ctx.memory->read<float>(lighting.address + offset + 8);
 
             if (std::abs(r - OUTDOOR_R) < 0.01f && std::abs(g - OUTDOOR_G) < 0.01f &&
                 std::abs(b - OUTDOOR_B) < 0.01f) {
@@ -125,11 +137,13 @@ namespace scanner::phases {
         constexpr float SHIFT_TOP_B = 250.0f / 255.0f;
 
         auto shift_top_offset =
-            memory->find_verified_offset_float({lighting.address}, {SHIFT_TOP_R}, 0x600, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {lighting.address}, {SHIFT_TOP_R}, 0x600, 0x4, 0.01f,
+                offset_registry.seed("Lighting", "ColorShift_Top"));
 
         if (shift_top_offset) {
-            float g = memory->read<float>(lighting.address + *shift_top_offset + 4);
-            float b = memory->read<float>(lighting.address + *shift_top_offset + 8);
+            float g = ctx.memory->read<float>(lighting.address + *shift_top_offset + 4);
+            float b = ctx.memory->read<float>(lighting.address + *shift_top_offset + 8);
             if (std::abs(g - SHIFT_TOP_G) < 0.01f && std::abs(b - SHIFT_TOP_B) < 0.01f) {
                 offset_registry.add("Lighting", "ColorShift_Top", *shift_top_offset);
             } else {
@@ -144,11 +158,13 @@ namespace scanner::phases {
         constexpr float SHIFT_BOTTOM_B = 196.0f / 255.0f;
 
         auto shift_bottom_offset =
-            memory->find_verified_offset_float({lighting.address}, {SHIFT_BOTTOM_R}, 0x600, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {lighting.address}, {SHIFT_BOTTOM_R}, 0x600, 0x4, 0.01f,
+                offset_registry.seed("Lighting", "ColorShift_Bottom"));
 
         if (shift_bottom_offset) {
-            float g = memory->read<float>(lighting.address + *shift_bottom_offset + 4);
-            float b = memory->read<float>(lighting.address + *shift_bottom_offset + 8);
+            float g = ctx.memory->read<float>(lighting.address + *shift_bottom_offset + 4);
+            float b = ctx.memory->read<float>(lighting.address + *shift_bottom_offset + 8);
             if (std::abs(g - SHIFT_BOTTOM_G) < 0.01f && std::abs(b - SHIFT_BOTTOM_B) < 0.01f) {
                 offset_registry.add("Lighting", "ColorShift_Bottom", *shift_bottom_offset);
             } else {
@@ -160,7 +176,9 @@ namespace scanner::phases {
 
         
         const auto exposure_compensation_offset =
-            memory->find_verified_offset_float({lighting.address}, {1.962f}, 0x400, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {lighting.address}, {1.962f}, 0x400, 0x4, 0.01f,
+                offset_registry.seed("Lighting", "ExposureCompensation"));
 
         if (!exposure_compensation_offset) {
             LOG_ERR("Failed to find ExposureCompensation offset");
@@ -170,7 +188,9 @@ namespace scanner::phases {
         offset_registry.add("Lighting", "ExposureCompensation", *exposure_compensation_offset);
 
         const auto geographic_latitude_offset =
-            memory->find_verified_offset_float({lighting.address}, {2.394f}, 0x400, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {lighting.address}, {2.394f}, 0x400, 0x4, 0.01f,
+                offset_registry.seed("Lighting", "GeographicLatitude"));
 
         if (!geographic_latitude_offset) {
             LOG_ERR("Failed to find GeographicLatitude offset");
@@ -180,7 +200,9 @@ namespace scanner::phases {
         offset_registry.add("Lighting", "GeographicLatitude", *geographic_latitude_offset);
 
         const auto fog_start_offset =
-            memory->find_verified_offset_float({lighting.address}, {345.241f}, 0x400, 0x4);
+            ctx.memory->find_verified_offset_float({lighting.address}, {345.241f}, 0x400, 0x4,
+                                                   0.01f,
+                                                   offset_registry.seed("Lighting", "FogStart"));
 
         if (!fog_start_offset) {
             LOG_ERR("Failed to find FogStart offset");
@@ -190,7 +212,9 @@ namespace scanner::phases {
         offset_registry.add("Lighting", "FogStart", *fog_start_offset);
 
         const auto fog_end_offset =
-            memory->find_verified_offset_float({lighting.address}, {631.243f}, 0x400, 0x4);
+            ctx.memory->find_verified_offset_float({lighting.address}, {631.243f}, 0x400, 0x4,
+                                                   0.01f,
+                                                   offset_registry.seed("Lighting", "FogEnd"));
 
         if (!fog_end_offset) {
             LOG_ERR("Failed to find FogEnd offset");
@@ -204,11 +228,13 @@ namespace scanner::phases {
         constexpr float FOG_COLOR_B = 127.0f / 255.0f;
 
         auto fog_color_offset =
-            memory->find_verified_offset_float({lighting.address}, {FOG_COLOR_R}, 0x600, 0x4);
+            ctx.memory->find_verified_offset_float({lighting.address}, {FOG_COLOR_R}, 0x600, 0x4,
+                                                   0.01f,
+                                                   offset_registry.seed("Lighting", "FogColor"));
 
         if (fog_color_offset) {
-            float g = memory->read<float>(lighting.address + *fog_color_offset + 4);
-            float b = memory->read<float>(lighting.address + *fog_color_offset + 8);
+            float g = ctx.memory->read<float>(lighting.address + *fog_color_offset + 4);
+            float b = ctx.memory->read<float>(lighting.address + *fog_color_offset + 8);
             if (std::abs(g - FOG_COLOR_G) < 0.01f && std::abs(b - FOG_COLOR_B) < 0.01f) {
                 offset_registry.add("Lighting", "FogColor", *fog_color_offset);
             } else {
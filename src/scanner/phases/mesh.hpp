@@ -16,8 +16,9 @@ namespace scanner::phases {
             return false;
         }
 
-        const auto mesh_id = memory->find_roblox_string_direct(
-            small_rock.address, "rbxassetid://847869656", 0x800, 0x8);
+        const auto mesh_id = ctx.memory->find_roblox_string_direct(
+            small_rock.address, "rbxassetid://847869656", 0x800, 0x8,
+            offset_registry.seed("Mesh", "MeshId"));
 
         if (!mesh_id) {
             LOG_ERR("Failed to get MeshId");
@@ -26,8 +27,9 @@ namespace scanner::phases {
 
         offset_registry.add("Mesh", "MeshId", *mesh_id);
 
-        const auto texture_id = memory->find_roblox_string_direct(
-            small_rock.address, "rbxassetid://847870798", 0x800, 0x8);
+        const auto texture_id = ctx.memory->find_roblox_string_direct(
+            small_rock.address, "rbxassetid://847870798", 0x800, 0x8,
+            offset_registry.seed("Mesh", "TextureId"));
 
         if (!texture_id) {
             LOG_ERR("Failed to get TextureId");
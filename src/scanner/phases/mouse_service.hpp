@@ -61,7 +61,7 @@ namespace scanner::phases {
         }
 
         const auto mouse_service =
-            sdk::instance_t(ctx.data_model).find_first_child_of_class("MouseService");
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child_of_class("MouseService");
 
         if (!mouse_service.is_valid()) {
             LOG_ERR("Could not find 'MouseService' inside data model.");
@@ -70,7 +70,7 @@ namespace scanner::phases {
 
         // use second occurrence not first.
         auto input_object_offset =
-            memory->find_rtti_offset_nth(mouse_service.address, "InputObject@RBX", 1);
+            ctx.memory->find_rtti_offset_nth(mouse_service.address, "InputObject@RBX", 1);
         if (!input_object_offset) {
             LOG_ERR("Failed to find InputObject offset (second occurrence)");
             return false;
@@ -79,13 +79,13 @@ namespace scanner::phases {
         offset_registry.add("MouseService", "InputObject", *input_object_offset);
 
         uintptr_t input_object_ptr =
-            memory->read<uintptr_t>(mouse_service.address + *input_object_offset);
+            ctx.memory->read<uintptr_t>(mouse_service.address + *input_object_offset);
         if (!input_object_ptr || input_object_ptr < 0x10000) {
             LOG_ERR("Failed to read InputObject pointer");
             return false;
         }
 
-        HWND roblox_window = memory->get_window_handle();
+        HWND roblox_window = ctx.memory->get_window_handle();
         if (!roblox_window) {
             LOG_ERR("Failed to get Roblox window handle");
             return false;
@@ -112,14 +112,13 @@ namespace scanner::phases {
                              static_cast<int>(mouse_positions[0].y));
         std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
 
-        auto offsets = memory->find_offsets_with_snapshots<Vector2>(
+        auto offsets = ctx.memory->find_offsets_with_snapshots<Vector2>(
             input_object_ptr, mouse_positions,
             [&](size_t i) {
                 move_mouse_in_window(roblox_window, static_cast<int>(mouse_positions[i].x),
                                      static_cast<int>(mouse_positions[i].y));
-                std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
             },
-            0x200, 0x4, SLEEP_MS);
+            0x200, 0x4, 2 * SLEEP_MS, offset_registry.seed("MouseService", "Position"));
 
         if (!offsets.empty()) {
             offset_registry.add("MouseService", "Position", offsets[0]);
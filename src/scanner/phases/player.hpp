@@ -11,28 +11,33 @@
 namespace scanner::phases {
 
     inline bool player(Context& ctx) {
-        const auto players = sdk::instance_t(ctx.data_model).find_first_child("Players");
+        const auto players =
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("Players");
         if (!players.is_valid()) {
             LOG_ERR("Players not found in DataModel");
             return false;
         }
 
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
 
-        auto local_player_offset = memory->find_rtti_offset(players.address, "Player@RBX");
+        auto local_player_offset = ctx.memory->find_rtti_offset(
+            players.address, "Player@RBX", 0x1000, 0x8,
+            offset_registry.seed("Players", "LocalPlayer"));
         if (!local_player_offset) {
             LOG_ERR("Failed to find LocalPlayer offset");
             return false;
         }
         offset_registry.add("Players", "LocalPlayer", *local_player_offset);
 
-        auto local_player = memory->read<uintptr_t>(players.address + *local_player_offset);
+        auto local_player = ctx.memory->read<uintptr_t>(players.address + *local_player_offset);
         if (!local_player) {
             LOG_ERR("Failed to read LocalPlayer pointer");
             return false;
         }
 
-        const auto model = memory->find_rtti_offset(local_player, "ModelInstance@RBX");
+        const auto model =
+            ctx.memory->find_rtti_offset(local_player, "ModelInstance@RBX", 0x1000, 0x8,
+                                         offset_registry.seed("Player", "Character"));
         if (!model) {
             LOG_ERR("Failed to find ModelInstance offset");
             return false;
@@ -40,14 +45,18 @@ namespace scanner::phases {
         offset_registry.add("Player", "Character", *model);
 
         auto display_name =
-            memory->find_roblox_string_direct(local_player, settings::display_name());
+            ctx.memory->find_roblox_string_direct(local_player, settings::display_name(), 0x1000,
+                                                  0x8,
+                                                  offset_registry.seed("Player", "DisplayName"));
         if (!display_name) {
             LOG_ERR("Failed to find DisplayName offset");
             return false;
         }
         offset_registry.add("Player", "DisplayName", *display_name);
 
-        auto user_id = memory->find_value_offset<uint64_t>(local_player, settings::user_id());
+        auto user_id = ctx.memory->find_value_offset<uint64_t>(
+            local_player, settings::user_id(), 0x1000, 0x8, 0, {},
+            offset_registry.seed("Player", "UserId"));
         if (!user_id) {
             LOG_ERR("Failed to find UserId offset");
             return false;
@@ -57,21 +66,23 @@ namespace scanner::phases {
         controller.set_team("red");
         std::this_thread::sleep_for(std::chrono::milliseconds(500));
 
-        auto team_offset = memory->find_rtti_offset(local_player, "Team@RBX");
+        auto team_offset = ctx.memory->find_rtti_offset(local_player, "Team@RBX", 0x1000, 0x8,
+                                                        offset_registry.seed("Player", "Team"));
 
         // im so sorry for this code, i know there is better ways cba to change it tho
         for (size_t off = 0; off < 0x500; off += 0x8) {
-            uintptr_t potential_team = memory->read<uintptr_t>(local_player + off);
+            uintptr_t potential_team = ctx.memory->read<uintptr_t>(local_player + off);
             if (potential_team && potential_team > 0x10000) {
-                uintptr_t vtable = memory->read<uintptr_t>(potential_team);
+                uintptr_t vtable = ctx.memory->read<uintptr_t>(potential_team);
                 if (vtable && vtable > 0x10000) {
-                    uintptr_t class_desc = memory->read<uintptr_t>(
+                    uintptr_t class_desc = ctx.memory->read<uintptr_t>(
                         potential_team + sdk::offsets::Instance::ClassDescriptor);
                     if (class_desc && class_desc > 0x10000) {
                         uintptr_t name_ptr =
-                            memory->read<uintptr_t>(class_desc + sdk::offsets::Instance::ClassName);
+                            ctx.memory->read<uintptr_t>(
+                                class_desc + sdk::offsets::Instance::ClassName);
                         if (name_ptr) {
-                            std::string class_name = memory->read_roblox_string(name_ptr);
+                            std::string class_name = ctx.memory->read_roblox_string(name_ptr);
                             if (class_name == "Team") {
                                 team_offset = off;
                                 break;
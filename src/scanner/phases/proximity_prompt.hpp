@@ -11,7 +11,7 @@ namespace scanner::phases {
 
     inline bool proximity_prompt(Context& ctx) {
         const auto replicated_storage =
-            sdk::instance_t(ctx.data_model).find_first_child("ReplicatedStorage");
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("ReplicatedStorage");
         if (!replicated_storage.is_valid()) {
             LOG_ERR("Failed to find ReplicatedStorage");
             return false;
@@ -30,7 +30,9 @@ namespace scanner::phases {
         }
 
         const auto action_text_offset =
-            memory->find_roblox_string_direct(prompt.address, "TestAction123", 0x400, 0x8);
+            ctx.memory->find_roblox_string_direct(
+                prompt.address, "TestAction123", 0x400, 0x8,
+                offset_registry.seed("ProximityPrompt", "ActionText"));
         if (!action_text_offset) {
             LOG_ERR("Failed to find ActionText offset");
             return false;
@@ -38,7 +40,9 @@ namespace scanner::phases {
         offset_registry.add("ProximityPrompt", "ActionText", *action_text_offset);
 
         const auto object_text_offset =
-            memory->find_roblox_string_direct(prompt.address, "TestObject456", 0x400, 0x8);
+            ctx.memory->find_roblox_string_direct(
+                prompt.address, "TestObject456", 0x400, 0x8,
+                offset_registry.seed("ProximityPrompt", "ObjectText"));
         if (!object_text_offset) {
             LOG_ERR("Failed to find ObjectText offset");
             return false;
@@ -46,7 +50,9 @@ namespace scanner::phases {
         offset_registry.add("ProximityPrompt", "ObjectText", *object_text_offset);
 
         const auto hold_duration_offset =
-            memory->find_verified_offset_float({prompt.address}, {2.56f}, 0x400, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {prompt.address}, {2.56f}, 0x400, 0x4, 0.01f,
+                offset_registry.seed("ProximityPrompt", "HoldDuration"));
         if (!hold_duration_offset) {
             LOG_ERR("Failed to find HoldDuration offset");
             return false;
@@ -54,18 +60,22 @@ namespace scanner::phases {
         offset_registry.add("ProximityPrompt", "HoldDuration", *hold_duration_offset);
 
         const auto keyboard_keycode_offset =
-            memory->find_value_offset<int32_t>(prompt.address, 101, 0x400, 0x4);
+            ctx.memory->find_value_offset<int32_t>(
+                prompt.address, 101, 0x400, 0x4, 0, {},
+                offset_registry.seed("ProximityPrompt", "KeyboardKeyCode"));
         if (!keyboard_keycode_offset) {
             LOG_ERR("Failed to find KeyboardKeyCode offset");
             return false;
         }
         offset_registry.add("ProximityPrompt", "KeyboardKeyCode", *keyboard_keycode_offset);
 
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
         constexpr int SLEEP_MS = 200;
 
         const auto max_distance_offset =
-            memory->find_value_offset<float>(prompt.address, 12.5f, 0x400, 0x4);
+            ctx.memory->find_value_offset<float>(
+                prompt.address, 12.5f, 0x400, 0x4, 0, {},
+                offset_registry.seed("ProximityPrompt", "MaxActivationDistance"));
         if (!max_distance_offset) {
             LOG_ERR("Failed to find MaxActivationDistance offset");
             return false;
@@ -76,13 +86,12 @@ namespace scanner::phases {
         controller.set_proximity_prompt_enabled(true);
         std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
 
-        auto enabled_offsets = memory->find_offsets_with_snapshots<uint8_t>(
+        auto enabled_offsets = ctx.memory->find_offsets_with_snapshots<uint8_t>(
             prompt.address, enabled_values,
             [&](size_t i) {
                 controller.set_proximity_prompt_enabled(enabled_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
             },
-            0x400, 0x1, SLEEP_MS);
+            0x400, 0x1, 2 * SLEEP_MS, offset_registry.seed("ProximityPrompt", "Enabled"));
 
         if (!enabled_offsets.empty()) {
             offset_registry.add("ProximityPrompt", "Enabled", enabled_offsets[0]);
@@ -95,13 +104,12 @@ namespace scanner::phases {
         controller.set_proximity_prompt_requires_line_of_sight(false);
         std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
 
-        auto requires_los_offsets = memory->find_offsets_with_snapshots<uint8_t>(
+        auto requires_los_offsets = ctx.memory->find_offsets_with_snapshots<uint8_t>(
             prompt.address, requires_los_values,
             [&](size_t i) {
                 controller.set_proximity_prompt_requires_line_of_sight(requires_los_values[i] == 1);
-                std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
             },
-            0x400, 0x1, SLEEP_MS);
+            0x400, 0x1, 2 * SLEEP_MS, offset_registry.seed("ProximityPrompt", "RequiresLineOfSight"));
 
         if (!requires_los_offsets.empty()) {
             offset_registry.add("ProximityPrompt", "RequiresLineOfSight", requires_los_offsets[0]);
@@ -11,7 +11,7 @@
 namespace scanner::phases {
     inline bool script(Context& ctx) {
         const auto replicated_storage =
-            sdk::instance_t(ctx.data_model).find_first_child("ReplicatedStorage");
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("ReplicatedStorage");
 
         if (!replicated_storage.is_valid()) {
             return false;
@@ -55,15 +55,17 @@ namespace scanner::phases {
 
         // module_script_bytecode
         for (size_t off = 0; off < 0x1000; off += 0x8) {
-            const auto embedded = memory->read(module_script.address + off);
+            const auto embedded = ctx.memory->read(module_script.address + off);
             if (!embedded)
                 continue;
 
-            const auto embedded2 = memory->read(module_script2.address + off);
+            const auto embedded2 = ctx.memory->read(module_script2.address + off);
             if (!embedded2)
                 continue;
 
-            const auto size = memory->find_verified_offset<int>({embedded, embedded2}, {61, 86});
+            const auto size = ctx.memory->find_verified_offset<int>(
+                {embedded, embedded2}, {61, 86}, 0x1000, 0x8,
+                offset_registry.seed("ByteCode", "Size"));
 
             if (size) {
                 offset_registry.add("ByteCode", "Size", *size);
@@ -75,11 +77,11 @@ namespace scanner::phases {
 
         // local_script_bytecode
         for (size_t off = 0; off < 0x1000; off += 0x8) {
-            const auto embedded = memory->read(local_script.address + off);
+            const auto embedded = ctx.memory->read(local_script.address + off);
             if (!embedded)
                 continue;
 
-            const auto size = memory->read<int>(embedded + offset_registry.get("ByteCode", "Size"));
+            const auto size = ctx.memory->read<int>(embedded + sdk::offsets::ByteCode::Size);
 
             if (size == 86) {
                 offset_registry.add("LocalScript", "Bytecode", off);
@@ -89,8 +91,8 @@ namespace scanner::phases {
 
         // module_script_hash
         for (size_t off = 0; off < 0x1000; off += 0x8) {
-            const auto a = memory->read(module_script.address + off);
-            const auto hash = memory->read<int>(a + 0x0);
+            const auto a = ctx.memory->read(module_script.address + off);
+            const auto hash = ctx.memory->read<int>(a + 0x0);
             if (hash == 1680946276) {
                 offset_registry.add("ModuleScript", "Hash", off);
                 break;
@@ -99,8 +101,8 @@ namespace scanner::phases {
 
         // local_script_hash
         for (size_t off = 0; off < 0x1000; off += 0x8) {
-            const auto a = memory->read(local_script.address + off);
-            const auto hash = memory->read<int>(a + 0x0);
+            const auto a = ctx.memory->read(local_script.address + off);
+            const auto hash = ctx.memory->read<int>(a + 0x0);
             if (hash == 1680946276) {
                 offset_registry.add("LocalScript", "Hash", off);
                 break;
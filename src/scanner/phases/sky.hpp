@@ -10,7 +10,7 @@
 namespace scanner::phases {
 
     inline bool sky(Context& ctx) {
-        auto lighting = sdk::instance_t(ctx.data_model).find_first_child("Lighting");
+        auto lighting = sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("Lighting");
         if (!lighting.is_valid()) {
             LOG_ERR("Lighting not valid");
             return false;
@@ -22,11 +22,12 @@ namespace scanner::phases {
             return false;
         }
 
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
         constexpr int SLEEP_MS = 400;
 
-        auto skybox_bk = memory->find_roblox_string_direct(
-            sky.address, "http://www.roblox.com/asset/?id=144933338");
+        auto skybox_bk = ctx.memory->find_roblox_string_direct(
+            sky.address, "http://www.roblox.com/asset/?id=144933338", 0x1000, 0x8,
+            offset_registry.seed("Sky", "SkyboxBk"));
         if (!skybox_bk) {
             LOG_ERR("Failed to get SkyboxBk");
             return false;
@@ -34,8 +35,9 @@ namespace scanner::phases {
 
         offset_registry.add("Sky", "SkyboxBk", *skybox_bk);
 
-        auto skybox_dn = memory->find_roblox_string_direct(
-            sky.address, "http://www.roblox.com/asset/?id=144931530");
+        auto skybox_dn = ctx.memory->find_roblox_string_direct(
+            sky.address, "http://www.roblox.com/asset/?id=144931530", 0x1000, 0x8,
+            offset_registry.seed("Sky", "SkyboxDn"));
         if (!skybox_dn) {
             LOG_ERR("Failed to get SkyboxDn");
             return false;
@@ -43,8 +45,9 @@ namespace scanner::phases {
 
         offset_registry.add("Sky", "SkyboxDn", *skybox_dn);
 
-        auto skybox_ft = memory->find_roblox_string_direct(
-            sky.address, "http://www.roblox.com/asset/?id=144933262");
+        auto skybox_ft = ctx.memory->find_roblox_string_direct(
+            sky.address, "http://www.roblox.com/asset/?id=144933262", 0x1000, 0x8,
+            offset_registry.seed("Sky", "SkyboxFt"));
         if (!skybox_ft) {
             LOG_ERR("Failed to get SkyboxFt");
             return false;
@@ -52,8 +55,9 @@ namespace scanner::phases {
 
         offset_registry.add("Sky", "SkyboxFt", *skybox_ft);
 
-        auto skybox_lf = memory->find_roblox_string_direct(
-            sky.address, "http://www.roblox.com/asset/?id=144933244");
+        auto skybox_lf = ctx.memory->find_roblox_string_direct(
+            sky.address, "http://www.roblox.com/asset/?id=144933244", 0x1000, 0x8,
+            offset_registry.seed("Sky", "SkyboxLf"));
         if (!skybox_lf) {
             LOG_ERR("Failed to get SkyboxLf");
             return false;
@@ -61,8 +65,9 @@ namespace scanner::phases {
 
         offset_registry.add("Sky", "SkyboxLf", *skybox_lf);
 
-        auto skybox_rt = memory->find_roblox_string_direct(
-            sky.address, "http://www.roblox.com/asset/?id=144933299");
+        auto skybox_rt = ctx.memory->find_roblox_string_direct(
+            sky.address, "http://www.roblox.com/asset/?id=144933299", 0x1000, 0x8,
+            offset_registry.seed("Sky", "SkyboxRt"));
         if (!skybox_rt) {
             LOG_ERR("Failed to get SkyboxRt");
             return false;
@@ -70,8 +75,9 @@ namespace scanner::phases {
 
         offset_registry.add("Sky", "SkyboxRt", *skybox_rt);
 
-        auto skybox_up = memory->find_roblox_string_direct(
-            sky.address, "http://www.roblox.com/asset/?id=144931564");
+        auto skybox_up = ctx.memory->find_roblox_string_direct(
+            sky.address, "http://www.roblox.com/asset/?id=144931564", 0x1000, 0x8,
+            offset_registry.seed("Sky", "SkyboxUp"));
         if (!skybox_up) {
             LOG_ERR("Failed to get SkyboxUp");
             return false;
@@ -80,7 +86,9 @@ namespace scanner::phases {
         offset_registry.add("Sky", "SkyboxUp", *skybox_up);
 
         auto moon_texture =
-            memory->find_roblox_string_direct(sky.address, "rbxasset://sky/moon.jpg");
+            ctx.memory->find_roblox_string_direct(sky.address, "rbxasset://sky/moon.jpg", 0x1000,
+                                                  0x8,
+                                                  offset_registry.seed("Sky", "MoonTextureId"));
         if (!moon_texture) {
             LOG_ERR("Failed to get MoonTextureId");
             return false;
@@ -88,7 +96,9 @@ namespace scanner::phases {
 
         offset_registry.add("Sky", "MoonTextureId", *moon_texture);
 
-        auto sun_texture = memory->find_roblox_string_direct(sky.address, "rbxasset://sky/sun.jpg");
+        auto sun_texture = ctx.memory->find_roblox_string_direct(
+            sky.address, "rbxasset://sky/sun.jpg", 0x1000, 0x8,
+            offset_registry.seed("Sky", "SunTextureId"));
         if (!sun_texture) {
             LOG_ERR("Failed to get SunTextureId");
             return false;
@@ -97,7 +107,8 @@ namespace scanner::phases {
         offset_registry.add("Sky", "SunTextureId", *sun_texture);
 
         const auto sun_angular_size_offset =
-            memory->find_verified_offset_float({sky.address}, {27.89f}, 0x1000, 0x2);
+            ctx.memory->find_verified_offset_float({sky.address}, {27.89f}, 0x1000, 0x2, 0.01f,
+                                                   offset_registry.seed("Sky", "SunAngularSize"));
 
         if (!sun_angular_size_offset) {
             LOG_ERR("Failed to find SunAngularSize offset in Sky");
@@ -107,7 +118,8 @@ namespace scanner::phases {
         offset_registry.add("Sky", "SunAngularSize", *sun_angular_size_offset);
 
         const auto star_count_offset =
-            memory->find_value_offset<int>(sky.address, 1337, 0x1000, 0x2);
+            ctx.memory->find_value_offset<int>(sky.address, 1337, 0x1000, 0x2, 0, {},
+                                               offset_registry.seed("Sky", "StarCount"));
 
         if (!star_count_offset) {
             LOG_ERR("Failed to find SunAngularSize offset in Sky");
@@ -117,7 +129,8 @@ namespace scanner::phases {
         offset_registry.add("Sky", "StarCount", *star_count_offset);
 
         const auto moon_angular_size_offset =
-            memory->find_verified_offset_float({sky.address}, {11.69f}, 0x1000, 0x2);
+            ctx.memory->find_verified_offset_float({sky.address}, {11.69f}, 0x1000, 0x2, 0.01f,
+                                                   offset_registry.seed("Sky", "MoonAngularSize"));
 
         if (!moon_angular_size_offset) {
             LOG_ERR("Failed to find MoonAngularSize offset in Sky");
@@ -131,13 +144,12 @@ namespace scanner::phases {
             std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
 
             std::vector<float> values = {0.0f, 90.0f};
-            auto offset = memory->find_offsets_with_snapshots<float>(
+            auto offset = ctx.memory->find_offsets_with_snapshots<float>(
                 sky.address, values,
                 [&](size_t i) {
                     controller.set_skybox_orientation(0.0f, values[i], 0.0f);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
                 },
-                0x600, 0x4);
+                0x600, 0x4, SLEEP_MS + 500, offset_registry.seed("Sky", "SkyboxOrientation"));
 
             if (!offset.empty()) {
                 offset_registry.add("Sky", "SkyboxOrientation", offset[0]);
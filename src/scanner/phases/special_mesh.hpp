@@ -24,8 +24,9 @@ namespace scanner::phases {
             return false;
         }
 
-        const auto mesh_id = memory->find_roblox_string_direct(
-            special_mesh_1.address, "http://www.roblox.com/Asset/?id=9982590", 0x800, 0x8);
+        const auto mesh_id = ctx.memory->find_roblox_string_direct(
+            special_mesh_1.address, "http://www.roblox.com/Asset/?id=9982590", 0x800, 0x8,
+            offset_registry.seed("SpecialMesh", "MeshId"));
 
         if (!mesh_id) {
             LOG_ERR("Failed to get MeshId for SpecialMesh");
@@ -42,11 +43,11 @@ namespace scanner::phases {
         constexpr float SPECIALMESH2_SCALE_Y = 16.6f;
         constexpr float SPECIALMESH2_SCALE_Z = 3.2f;
 
-        const auto scale_offset = memory->find_vector3_offset(
+        const auto scale_offset = ctx.memory->find_vector3_offset(
             {special_mesh_1.address, special_mesh_2.address},
             {{SPECIALMESH1_SCALE_X, SPECIALMESH1_SCALE_Y, SPECIALMESH1_SCALE_Z},
              {SPECIALMESH2_SCALE_X, SPECIALMESH2_SCALE_Y, SPECIALMESH2_SCALE_Z}},
-            0x1000, 0.5f);
+            0x1000, 0.5f, offset_registry.seed("SpecialMesh", "Scale"));
 
         if (!scale_offset) {
             LOG_ERR("Failed to get SpecialMesh Scale");
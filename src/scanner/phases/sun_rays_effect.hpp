@@ -10,7 +10,8 @@
 namespace scanner::phases {
 
     inline bool sun_rays_effect(Context& ctx) {
-        const auto lighting = sdk::instance_t(ctx.data_model).find_first_child("Lighting");
+        const auto lighting =
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("Lighting");
         if (!lighting.is_valid()) {
             LOG_ERR("Failed to find Lighting");
             return false;
@@ -22,8 +23,9 @@ namespace scanner::phases {
             return false;
         }
 
-        const auto intensity_offset = memory->find_verified_offset_float(
-            {sun_rays_effect_inst.address}, {0.419f}, 0x400, 0x2);
+        const auto intensity_offset = ctx.memory->find_verified_offset_float(
+            {sun_rays_effect_inst.address}, {0.419f}, 0x400, 0x2, 0.01f,
+            offset_registry.seed("SunRaysEffect", "Intensity"));
 
         if (!intensity_offset) {
             LOG_ERR("Failed to find Intensity offset for SunRaysEffect");
@@ -32,7 +34,7 @@ namespace scanner::phases {
 
         offset_registry.add("SunRaysEffect", "Intensity", *intensity_offset);
 
-        const auto spread_offset = memory->find_verified_offset_float(
+        const auto spread_offset = ctx.memory->find_verified_offset_float(
             {sun_rays_effect_inst.address}, {0.556f}, 0x400, 0x2);
 
         if (!spread_offset) {
@@ -10,7 +10,8 @@ namespace scanner::phases {
             return false;
         }
 
-        const auto teams = sdk::instance_t(ctx.data_model).find_first_child_of_class("Teams");
+        const auto teams =
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child_of_class("Teams");
 
         if (!teams.is_valid()) {
             LOG_ERR("Could not find 'Teams' inside data model.");
@@ -20,7 +21,8 @@ namespace scanner::phases {
         const auto blue_team = teams.find_first_child("Blue Team");
 
         const auto team_color_offset =
-            memory->find_value_offset<uint32_t>(blue_team.address, 23, 0x200, 0x4);
+            ctx.memory->find_value_offset<uint32_t>(blue_team.address, 23, 0x200, 0x4, 0, {},
+                                                    offset_registry.seed("Team", "Color"));
 
         if (!team_color_offset) {
             LOG_ERR("Failed to get Team Color offset");
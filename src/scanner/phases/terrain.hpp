@@ -10,19 +10,20 @@
 
 namespace scanner::phases {
 
-    inline std::optional<size_t> find_material_colors_vec_offset(uintptr_t terrain_address,
+    inline std::optional<size_t> find_material_colors_vec_offset(Memory& mem,
+                                                                 uintptr_t terrain_address,
                                                                  uint8_t test_r, uint8_t test_g,
                                                                  uint8_t test_b) {
         for (size_t vec_offset = 0x200; vec_offset < 0x500; vec_offset += 0x8) {
-            uintptr_t data_ptr = memory->read<uintptr_t>(terrain_address + vec_offset);
+            uintptr_t data_ptr = mem.read<uintptr_t>(terrain_address + vec_offset);
             if (!data_ptr || data_ptr < 0x10000)
                 continue;
 
             for (size_t material_idx = 0; material_idx < 100; material_idx++) {
                 size_t color_offset = material_idx * 3;
-                uint8_t r = memory->read<uint8_t>(data_ptr + color_offset);
-                uint8_t g = memory->read<uint8_t>(data_ptr + color_offset + 1);
-                uint8_t b = memory->read<uint8_t>(data_ptr + color_offset + 2);
+                uint8_t r = mem.read<uint8_t>(data_ptr + color_offset);
+                uint8_t g = mem.read<uint8_t>(data_ptr + color_offset + 1);
+                uint8_t b = mem.read<uint8_t>(data_ptr + color_offset + 2);
 
                 if (r == test_r && g == test_g && b == test_b) {
                     return vec_offset;
@@ -45,7 +46,9 @@ namespace scanner::phases {
         }
 
         const auto grass_length_offset =
-            memory->find_verified_offset_float({terrain_inst.address}, {0.723f}, 0x1000, 0x4);
+            ctx.memory->find_verified_offset_float({terrain_inst.address}, {0.723f}, 0x1000, 0x4,
+                                                   0.01f,
+                                                   offset_registry.seed("Terrain", "GrassLength"));
 
         if (!grass_length_offset) {
             LOG_ERR("Failed to find GrassLength offset for Terrain");
@@ -59,7 +62,7 @@ namespace scanner::phases {
         material colors
         */
         auto material_colors_vec_offset =
-            find_material_colors_vec_offset(terrain_inst.address, 80, 84, 84);
+            find_material_colors_vec_offset(*ctx.memory, terrain_inst.address, 80, 84, 84);
 
         if (!material_colors_vec_offset) {
             LOG_ERR("Failed to find MaterialColors vector pointer offset for Terrain");
@@ -69,14 +72,14 @@ namespace scanner::phases {
         offset_registry.add("Terrain", "MaterialColors", *material_colors_vec_offset);
 
         uintptr_t material_colors_data =
-            memory->read<uintptr_t>(terrain_inst.address + *material_colors_vec_offset);
+            ctx.memory->read<uintptr_t>(terrain_inst.address + *material_colors_vec_offset);
         if (!material_colors_data || material_colors_data < 0x10000) {
             LOG_ERR("Failed to read MaterialColors data pointer");
             return false;
         }
 
         size_t material_colors_size =
-            memory->read<size_t>(terrain_inst.address + *material_colors_vec_offset + 0x8);
+            ctx.memory->read<size_t>(terrain_inst.address + *material_colors_vec_offset + 0x8);
         if (material_colors_size == 0 || material_colors_size > 200) {
             material_colors_size = 100;
         }
@@ -84,9 +87,9 @@ namespace scanner::phases {
         auto find_material_index = [&](uint8_t r, uint8_t g, uint8_t b) -> std::optional<size_t> {
             for (size_t material_idx = 0; material_idx < material_colors_size; material_idx++) {
                 size_t color_offset = material_idx * 3;
-                uint8_t read_r = memory->read<uint8_t>(material_colors_data + color_offset);
-                uint8_t read_g = memory->read<uint8_t>(material_colors_data + color_offset + 1);
-                uint8_t read_b = memory->read<uint8_t>(material_colors_data + color_offset + 2);
+                uint8_t read_r = ctx.memory->read<uint8_t>(material_colors_data + color_offset);
+                uint8_t read_g = ctx.memory->read<uint8_t>(material_colors_data + color_offset + 1);
+                uint8_t read_b = ctx.memory->read<uint8_t>(material_colors_data + color_offset + 2);
 
                 if (read_r == r && read_g == g && read_b == b) {
                     return material_idx;
@@ -132,12 +135,13 @@ namespace scanner::phases {
         constexpr float WATER_COLOR_G = 84.0f / 255.0f;
         constexpr float WATER_COLOR_B = 92.0f / 255.0f;
 
-        auto water_color_offset = memory->find_verified_offset_float({terrain_inst.address},
-                                                                     {WATER_COLOR_R}, 0x1000, 0x4);
+        auto water_color_offset = ctx.memory->find_verified_offset_float(
+            {terrain_inst.address}, {WATER_COLOR_R}, 0x1000, 0x4, 0.01f,
+            offset_registry.seed("Terrain", "WaterColor"));
 
         if (water_color_offset) {
-            float g = memory->read<float>(terrain_inst.address + *water_color_offset + 4);
-            float b = memory->read<float>(terrain_inst.address + *water_color_offset + 8);
+            float g = ctx.memory->read<float>(terrain_inst.address + *water_color_offset + 4);
+            float b = ctx.memory->read<float>(terrain_inst.address + *water_color_offset + 8);
             if (std::abs(g - WATER_COLOR_G) < 0.01f && std::abs(b - WATER_COLOR_B) < 0.01f) {
                 offset_registry.add("Terrain", "WaterColor", *water_color_offset);
             } else {
@@ -148,7 +152,9 @@ namespace scanner::phases {
         }
 
         const auto water_reflectance_offset =
-            memory->find_verified_offset_float({terrain_inst.address}, {0.345f}, 0x1000, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {terrain_inst.address}, {0.345f}, 0x1000, 0x4, 0.01f,
+                offset_registry.seed("Terrain", "WaterReflectance"));
 
         if (!water_reflectance_offset) {
             LOG_ERR("Failed to find WaterReflectance offset for Terrain");
@@ -157,7 +163,9 @@ namespace scanner::phases {
         offset_registry.add("Terrain", "WaterReflectance", *water_reflectance_offset);
 
         const auto water_transparency_offset =
-            memory->find_verified_offset_float({terrain_inst.address}, {0.812f}, 0x1000, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {terrain_inst.address}, {0.812f}, 0x1000, 0x4, 0.01f,
+                offset_registry.seed("Terrain", "WaterTransparency"));
 
         if (!water_transparency_offset) {
             LOG_ERR("Failed to find WaterTransparency offset for Terrain");
@@ -166,7 +174,9 @@ namespace scanner::phases {
         offset_registry.add("Terrain", "WaterTransparency", *water_transparency_offset);
 
         const auto water_wave_size_offset =
-            memory->find_verified_offset_float({terrain_inst.address}, {0.156f}, 0x1000, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {terrain_inst.address}, {0.156f}, 0x1000, 0x4, 0.01f,
+                offset_registry.seed("Terrain", "WaterWaveSize"));
 
         if (!water_wave_size_offset) {
             LOG_ERR("Failed to find WaterWaveSize offset for Terrain");
@@ -175,7 +185,9 @@ namespace scanner::phases {
         offset_registry.add("Terrain", "WaterWaveSize", *water_wave_size_offset);
 
         const auto water_wave_speed_offset =
-            memory->find_verified_offset_float({terrain_inst.address}, {30.34f}, 0x1000, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {terrain_inst.address}, {30.34f}, 0x1000, 0x4, 0.01f,
+                offset_registry.seed("Terrain", "WaterWaveSpeed"));
 
         if (!water_wave_speed_offset) {
             LOG_ERR("Failed to find WaterWaveSpeed offset for Terrain");
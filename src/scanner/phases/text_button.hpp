@@ -11,7 +11,7 @@ namespace scanner::phases {
 
     inline bool text_button(Context& ctx) {
         const auto replicated_storage =
-            sdk::instance_t(ctx.data_model).find_first_child("ReplicatedStorage");
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("ReplicatedStorage");
         if (!replicated_storage.is_valid()) {
             LOG_ERR("Failed to find ReplicatedStorage");
             return false;
@@ -31,7 +31,9 @@ namespace scanner::phases {
         }
 
         const auto line_height_offset =
-            memory->find_verified_offset_float({text_button.address}, {2.246f}, 0x1000, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {text_button.address}, {2.246f}, 0x1000, 0x4, 0.01f,
+                offset_registry.seed("TextButton", "LineHeight"));
 
         if (!line_height_offset) {
             LOG_ERR("Failed to find LineHeight offset for TextButton");
@@ -40,9 +42,9 @@ namespace scanner::phases {
 
         offset_registry.add("TextButton", "LineHeight", *line_height_offset);
 
-        Vector2 current_text_bounds = memory->read<Vector2>(text_button.address + 0x200);
+        Vector2 current_text_bounds = ctx.memory->read<Vector2>(text_button.address + 0x200);
         for (size_t offset = 0; offset < 0x1000; offset += 0x4) {
-            Vector2 value = memory->read<Vector2>(text_button.address + offset);
+            Vector2 value = ctx.memory->read<Vector2>(text_button.address + offset);
             if (value.y > 70.0f && value.y < 76.0f && value.x > 0.0f && value.x < 1000.0f) {
                 current_text_bounds = value;
                 break;
@@ -51,7 +53,7 @@ namespace scanner::phases {
 
         std::vector<Vector2> text_bounds_values = {current_text_bounds};
 
-        auto text_bounds_offsets = memory->find_offsets_with_snapshots<Vector2>(
+        auto text_bounds_offsets = ctx.memory->find_offsets_with_snapshots<Vector2>(
             text_button.address, text_bounds_values, [&](size_t i) {}, 0x1000, 0x4, 100);
 
         std::optional<size_t> text_bounds_offset;
@@ -63,7 +65,9 @@ namespace scanner::phases {
         }
 
         const auto text_transparency_offset =
-            memory->find_verified_offset_float({text_button.address}, {0.456f}, 0x2000, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {text_button.address}, {0.456f}, 0x2000, 0x4, 0.01f,
+                offset_registry.seed("TextButton", "TextTransparency"));
 
         if (!text_transparency_offset) {
             LOG_ERR("Failed to find TextTransparency offset for TextButton");
@@ -77,11 +81,13 @@ namespace scanner::phases {
         constexpr float TEXT_COLOR_B = 182.0f / 255.0f;
 
         auto text_color_offset =
-            memory->find_verified_offset_float({text_button.address}, {TEXT_COLOR_R}, 0x2000, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {text_button.address}, {TEXT_COLOR_R}, 0x2000, 0x4, 0.01f,
+                offset_registry.seed("TextButton", "TextColor3"));
 
         if (text_color_offset) {
-            float g = memory->read<float>(text_button.address + *text_color_offset + 4);
-            float b = memory->read<float>(text_button.address + *text_color_offset + 8);
+            float g = ctx.memory->read<float>(text_button.address + *text_color_offset + 4);
+            float b = ctx.memory->read<float>(text_button.address + *text_color_offset + 8);
             if (std::abs(g - TEXT_COLOR_G) < 0.01f && std::abs(b - TEXT_COLOR_B) < 0.01f) {
                 offset_registry.add("TextButton", "TextColor3", *text_color_offset);
             } else {
@@ -96,11 +102,13 @@ namespace scanner::phases {
         constexpr float STROKE_COLOR_B = 18.0f / 255.0f;
 
         auto stroke_color_offset =
-            memory->find_verified_offset_float({text_button.address}, {STROKE_COLOR_R}, 0x2000, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {text_button.address}, {STROKE_COLOR_R}, 0x2000, 0x4, 0.01f,
+                offset_registry.seed("TextButton", "TextStrokeColor3"));
 
         if (stroke_color_offset) {
-            float g = memory->read<float>(text_button.address + *stroke_color_offset + 4);
-            float b = memory->read<float>(text_button.address + *stroke_color_offset + 8);
+            float g = ctx.memory->read<float>(text_button.address + *stroke_color_offset + 4);
+            float b = ctx.memory->read<float>(text_button.address + *stroke_color_offset + 8);
             if (std::abs(g - STROKE_COLOR_G) < 0.01f && std::abs(b - STROKE_COLOR_B) < 0.01f) {
                 offset_registry.add("TextButton", "TextStrokeColor3", *stroke_color_offset);
             } else {
@@ -117,8 +125,9 @@ namespace scanner::phases {
                 exclude_offsets.push_back(*text_bounds_offset + 4);
             }
 
-            auto text_size_offset = memory->find_value_offset<int32_t>(
-                text_button.address, 73, 0x2000, 0x4, 0, exclude_offsets);
+            auto text_size_offset = ctx.memory->find_value_offset<int32_t>(
+                text_button.address, 73, 0x2000, 0x4, 0, exclude_offsets,
+                offset_registry.seed("TextButton", "TextSize"));
 
             if (text_size_offset) {
                 offset_registry.add("TextButton", "TextSize", *text_size_offset);
@@ -131,7 +140,7 @@ namespace scanner::phases {
 
         std::vector<size_t> text_offsets;
         for (size_t offset = 0; offset < 0x2000; offset += 0x8) {
-            std::string read_str = memory->read_string(text_button.address + offset, 32);
+            std::string read_str = ctx.memory->read_string(text_button.address + offset, 32);
             if (read_str == "jonah dumper") {
                 text_offsets.push_back(offset);
             }
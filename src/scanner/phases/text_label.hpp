@@ -11,7 +11,7 @@ namespace scanner::phases {
 
     inline bool text_label(Context& ctx) {
         const auto replicated_storage =
-            sdk::instance_t(ctx.data_model).find_first_child("ReplicatedStorage");
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("ReplicatedStorage");
         if (!replicated_storage.is_valid()) {
             LOG_ERR("Failed to find ReplicatedStorage");
             return false;
@@ -31,7 +31,9 @@ namespace scanner::phases {
         }
 
         const auto line_height_offset =
-            memory->find_verified_offset_float({text_label.address}, {2.246f}, 0x1000, 0x4);
+            ctx.memory->find_verified_offset_float({text_label.address}, {2.246f}, 0x1000, 0x4,
+                                                   0.01f,
+                                                   offset_registry.seed("TextLabel", "LineHeight"));
 
         if (!line_height_offset) {
             LOG_ERR("Failed to find LineHeight offset for TextLabel");
@@ -41,7 +43,9 @@ namespace scanner::phases {
         offset_registry.add("TextLabel", "LineHeight", *line_height_offset);
 
         const auto max_visible_graphemes_offset =
-            memory->find_value_offset<uint32_t>(text_label.address, 4323, 0x1000, 0x4);
+            ctx.memory->find_value_offset<uint32_t>(
+                text_label.address, 4323, 0x1000, 0x4, 0, {},
+                offset_registry.seed("TextLabel", "MaxVisibleGraphemes"));
 
         if (!max_visible_graphemes_offset) {
             LOG_ERR("Failed to find MaxVisibleGraphemes offset for TextLabel");
@@ -50,9 +54,9 @@ namespace scanner::phases {
 
         offset_registry.add("TextLabel", "MaxVisibleGraphemes", *max_visible_graphemes_offset);
 
-        Vector2 current_text_bounds = memory->read<Vector2>(text_label.address + 0x200);
+        Vector2 current_text_bounds = ctx.memory->read<Vector2>(text_label.address + 0x200);
         for (size_t offset = 0; offset < 0x1000; offset += 0x4) {
-            Vector2 value = memory->read<Vector2>(text_label.address + offset);
+            Vector2 value = ctx.memory->read<Vector2>(text_label.address + offset);
             if (value.y > 70.0f && value.y < 76.0f && value.x > 0.0f && value.x < 1000.0f) {
                 current_text_bounds = value;
                 break;
@@ -61,7 +65,7 @@ namespace scanner::phases {
 
         std::vector<Vector2> text_bounds_values = {current_text_bounds};
 
-        auto text_bounds_offsets = memory->find_offsets_with_snapshots<Vector2>(
+        auto text_bounds_offsets = ctx.memory->find_offsets_with_snapshots<Vector2>(
             text_label.address, text_bounds_values, [&](size_t i) {}, 0x1000, 0x4, 100);
 
         std::optional<size_t> text_bounds_offset;
@@ -73,7 +77,9 @@ namespace scanner::phases {
         }
 
         const auto text_stroke_transparency_offset =
-            memory->find_verified_offset_float({text_label.address}, {0.864f}, 0x1000, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {text_label.address}, {0.864f}, 0x1000, 0x4, 0.01f,
+                offset_registry.seed("TextLabel", "TextStrokeTransparency"));
 
         if (!text_stroke_transparency_offset) {
             LOG_ERR("Failed to find TextStrokeTransparency offset for TextLabel");
@@ -84,7 +90,9 @@ namespace scanner::phases {
                             *text_stroke_transparency_offset);
 
         const auto text_transparency_offset =
-            memory->find_verified_offset_float({text_label.address}, {0.456f}, 0x1000, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {text_label.address}, {0.456f}, 0x1000, 0x4, 0.01f,
+                offset_registry.seed("TextLabel", "TextTransparency"));
 
         if (!text_transparency_offset) {
             LOG_ERR("Failed to find TextTransparency offset for TextLabel");
@@ -98,11 +106,13 @@ namespace scanner::phases {
         constexpr float TEXT_COLOR_B = 182.0f / 255.0f;
 
         auto text_color_offset =
-            memory->find_verified_offset_float({text_label.address}, {TEXT_COLOR_R}, 0x1000, 0x4);
+            ctx.memory->find_verified_offset_float({text_label.address}, {TEXT_COLOR_R}, 0x1000,
+                                                   0x4, 0.01f,
+                                                   offset_registry.seed("TextLabel", "TextColor3"));
 
         if (text_color_offset) {
-            float g = memory->read<float>(text_label.address + *text_color_offset + 4);
-            float b = memory->read<float>(text_label.address + *text_color_offset + 8);
+            float g = ctx.memory->read<float>(text_label.address + *text_color_offset + 4);
+            float b = ctx.memory->read<float>(text_label.address + *text_color_offset + 8);
             if (std::abs(g - TEXT_COLOR_G) < 0.01f && std::abs(b - TEXT_COLOR_B) < 0.01f) {
                 offset_registry.add("TextLabel", "TextColor3", *text_color_offset);
             } else {
@@ -117,11 +127,13 @@ namespace scanner::phases {
         constexpr float STROKE_COLOR_B = 18.0f / 255.0f;
 
         auto stroke_color_offset =
-            memory->find_verified_offset_float({text_label.address}, {STROKE_COLOR_R}, 0x1000, 0x4);
+            ctx.memory->find_verified_offset_float(
+                {text_label.address}, {STROKE_COLOR_R}, 0x1000, 0x4, 0.01f,
+                offset_registry.seed("TextLabel", "TextStrokeColor3"));
 
         if (stroke_color_offset) {
-            float g = memory->read<float>(text_label.address + *stroke_color_offset + 4);
-            float b = memory->read<float>(text_label.address + *stroke_color_offset + 8);
+            float g = ctx.memory->read<float>(text_label.address + *stroke_color_offset + 4);
+            float b = ctx.memory->read<float>(text_label.address + *stroke_color_offset + 8);
             if (std::abs(g - STROKE_COLOR_G) < 0.01f && std::abs(b - STROKE_COLOR_B) < 0.01f) {
                 offset_registry.add("TextLabel", "TextStrokeColor3", *stroke_color_offset);
             } else {
@@ -138,8 +150,9 @@ namespace scanner::phases {
                 exclude_offsets.push_back(*text_bounds_offset + 4);
             }
 
-            auto text_size_offset = memory->find_value_offset<int32_t>(
-                text_label.address, 73, 0x1000, 0x4, 0, exclude_offsets);
+            auto text_size_offset = ctx.memory->find_value_offset<int32_t>(
+                text_label.address, 73, 0x1000, 0x4, 0, exclude_offsets,
+                offset_registry.seed("TextLabel", "TextSize"));
 
             if (text_size_offset) {
                 offset_registry.add("TextLabel", "TextSize", *text_size_offset);
@@ -152,7 +165,7 @@ namespace scanner::phases {
 
         std::vector<size_t> text_offsets;
         for (size_t offset = 0; offset < 0x1000; offset += 0x8) {
-            std::string read_str = memory->read_string(text_label.address + offset, 32);
+            std::string read_str = ctx.memory->read_string(text_label.address + offset, 32);
             if (read_str == "jonah dumper") {
                 text_offsets.push_back(offset);
             }
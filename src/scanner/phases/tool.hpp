@@ -1,5 +1,6 @@
 #pragma once
 #include "control/control.hpp"
+#include "flag_probe.hpp"
 #include "memory/memory.h"
 #include "scanner.hpp"
 #include "utils/offset_registry.hpp"
@@ -10,7 +11,7 @@ namespace scanner::phases {
 
     inline bool tool(Context& ctx) {
         const auto replicated_storage =
-            sdk::instance_t(ctx.data_model).find_first_child("ReplicatedStorage");
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("ReplicatedStorage");
         if (!replicated_storage.is_valid()) {
             LOG_ERR("Failed to find ReplicatedStorage");
             return false;
@@ -22,86 +23,33 @@ namespace scanner::phases {
             return false;
         }
 
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
         constexpr int SLEEP_MS = 200;
 
         {
-            controller.set_tool_can_be_dropped(true);
-            std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
-
-            std::vector<uint8_t> values = {1, 0, 1};
-            auto offset = memory->find_offsets_with_snapshots<uint8_t>(
-                tool1.address, values,
-                [&](size_t i) {
-                    controller.set_tool_can_be_dropped(values[i] == 1);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
-                },
-                0x800, 0x1);
-
-            if (!offset.empty()) {
-                offset_registry.add("Tool", "CanBeDropped", offset[0]);
-            } else {
-                LOG_ERR("Failed to find CanBeDropped offset");
-            }
-        }
-
-        {
-            controller.set_tool_enabled(true);
-            std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
-
-            std::vector<uint8_t> values = {1, 0, 1};
-            auto offset = memory->find_offsets_with_snapshots<uint8_t>(
-                tool1.address, values,
-                [&](size_t i) {
-                    controller.set_tool_enabled(values[i] == 1);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
-                },
-                0x800, 0x1);
-
-            if (!offset.empty()) {
-                offset_registry.add("Tool", "Enabled", offset[0]);
-            } else {
-                LOG_ERR("Failed to find Enabled offset");
-            }
-        }
-
-        {
-            controller.set_tool_manual_activation(false);
-            std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
-
-            std::vector<uint8_t> values = {0, 1, 0};
-            auto offset = memory->find_offsets_with_snapshots<uint8_t>(
-                tool1.address, values,
-                [&](size_t i) {
-                    controller.set_tool_manual_activation(values[i] == 1);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
-                },
-                0x800, 0x1);
-
-            if (!offset.empty()) {
-                offset_registry.add("Tool", "ManualActivationOnly", offset[0]);
-            } else {
-                LOG_ERR("Failed to find ManualActivationOnly offset");
-            }
-        }
-
-        {
-            controller.set_tool_requires_handle(true);
-            std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
-
-            std::vector<uint8_t> values = {1, 0, 1};
-            auto offset = memory->find_offsets_with_snapshots<uint8_t>(
-                tool1.address, values,
-                [&](size_t i) {
-                    controller.set_tool_requires_handle(values[i] == 1);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
-                },
-                0x800, 0x1);
+            const std::vector<std::pair<std::string, FlagProbe>> flags = {
+                {"CanBeDropped",
+                 {"set_tool_can_be_dropped", {}, offset_registry.seed("Tool", "CanBeDropped")}},
+                {"Enabled", {"set_tool_enabled", {}, offset_registry.seed("Tool", "Enabled")}},
+                {"ManualActivationOnly",
+                 {"set_tool_manual_activation", {},
+                  offset_registry.seed("Tool", "ManualActivationOnly")}},
+                {"RequiresHandle",
+                 {"set_tool_requires_handle", {}, offset_registry.seed("Tool", "RequiresHandle")}},
+            };
 
-            if (!offset.empty()) {
-                offset_registry.add("Tool", "RequiresHandle", offset[0]);
-            } else {
-                LOG_ERR("Failed to find RequiresHandle offset");
+            std::vector<FlagProbe> probes;
+            for (const auto& [name, probe] : flags)
+                probes.push_back(probe);
+
+            auto offsets =
+                find_flag_offsets(*ctx.memory, controller, tool1.address, probes, 0x800, SLEEP_MS);
+            for (size_t i = 0; i < flags.size(); i++) {
+                if (offsets[i].has_value()) {
+                    offset_registry.add("Tool", flags[i].first, *offsets[i]);
+                } else {
+                    LOG_ERR("Failed to find {} offset", flags[i].first);
+                }
             }
         }
 
@@ -116,14 +64,13 @@ namespace scanner::phases {
                                          grip_positions[0].z);
             std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
 
-            auto offsets = memory->find_offsets_with_snapshots<Vector3>(
+            auto offsets = ctx.memory->find_offsets_with_snapshots<Vector3>(
                 tool1.address, grip_positions,
                 [&](size_t i) {
                     controller.set_tool_grip_pos(grip_positions[i].x, grip_positions[i].y,
                                                  grip_positions[i].z);
-                    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_MS));
                 },
-                0x800, 0x4);
+                0x800, 0x4, SLEEP_MS + 500, offset_registry.seed("Tool", "Grip", 0x24));
 
             if (!offsets.empty()) {
                 offset_registry.add("Tool", "Grip", offsets[0] - 0x24);
@@ -137,7 +84,7 @@ namespace scanner::phases {
         }
 
         for (size_t offset = 0; offset < 0x800; offset += 0x8) {
-            std::string str = memory->read_string(tool1.address + offset, 32);
+            std::string str = ctx.memory->read_string(tool1.address + offset, 32);
             if (str == "jonah") {
                 offset_registry.add("Tool", "ToolTip", offset);
                 break;
@@ -11,7 +11,7 @@ namespace scanner::phases {
 
     inline bool ui_gradient(Context& ctx) {
         const auto replicated_storage =
-            sdk::instance_t(ctx.data_model).find_first_child("ReplicatedStorage");
+            sdk::instance_t(ctx.memory, ctx.data_model).find_first_child("ReplicatedStorage");
         if (!replicated_storage.is_valid()) {
             LOG_ERR("Failed to find ReplicatedStorage");
             return false;
@@ -28,11 +28,13 @@ namespace scanner::phases {
         constexpr float COLOR_B = 182.0f / 255.0f;
 
         auto color_offset =
-            memory->find_verified_offset_float({ui_gradient.address}, {COLOR_R}, 0x600, 0x4);
+            ctx.memory->find_verified_offset_float({ui_gradient.address}, {COLOR_R}, 0x600, 0x4,
+                                                   0.01f,
+                                                   offset_registry.seed("UIGradient", "Color"));
 
         if (color_offset) {
-            float g = memory->read<float>(ui_gradient.address + *color_offset + 4);
-            float b = memory->read<float>(ui_gradient.address + *color_offset + 8);
+            float g = ctx.memory->read<float>(ui_gradient.address + *color_offset + 4);
+            float b = ctx.memory->read<float>(ui_gradient.address + *color_offset + 8);
             if (std::abs(g - COLOR_G) < 0.01f && std::abs(b - COLOR_B) < 0.01f) {
                 offset_registry.add("UIGradient", "Color", *color_offset);
             } else {
@@ -43,7 +45,9 @@ namespace scanner::phases {
         }
 
         const auto offset_offset =
-            memory->find_verified_offset_float({ui_gradient.address}, {102.45f}, 0x400, 0x2);
+            ctx.memory->find_verified_offset_float({ui_gradient.address}, {102.45f}, 0x400, 0x2,
+                                                   0.01f,
+                                                   offset_registry.seed("UIGradient", "Offset"));
 
         if (!offset_offset) {
             LOG_ERR("Failed to find offset offset for UIGradient");
@@ -53,7 +57,9 @@ namespace scanner::phases {
         offset_registry.add("UIGradient", "Offset", *offset_offset);
 
         const auto rotation_offset =
-            memory->find_verified_offset_float({ui_gradient.address}, {67.67f}, 0x400, 0x2);
+            ctx.memory->find_verified_offset_float({ui_gradient.address}, {67.67f}, 0x400, 0x2,
+                                                   0.01f,
+                                                   offset_registry.seed("UIGradient", "Rotation"));
 
         if (!rotation_offset) {
             LOG_ERR("Failed to find Rotation offset for UIGradient");
@@ -63,7 +69,9 @@ namespace scanner::phases {
         offset_registry.add("UIGradient", "Rotation", *rotation_offset);
 
         const auto transparency_offset =
-            memory->find_verified_offset_float({ui_gradient.address}, {42.56f}, 0x400, 0x2);
+            ctx.memory->find_verified_offset_float(
+                {ui_gradient.address}, {42.56f}, 0x400, 0x2, 0.01f,
+                offset_registry.seed("UIGradient", "Transparency"));
 
         if (!transparency_offset) {
             LOG_ERR("Failed to find Transparency offset for UIGradient");
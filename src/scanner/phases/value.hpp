@@ -10,8 +10,8 @@ namespace scanner::phases {
             return false;
         }
 
-        const auto replicated_storage =
-            sdk::instance_t(ctx.data_model).find_first_child_of_class("ReplicatedStorage");
+        const auto replicated_storage = sdk::instance_t(ctx.memory, ctx.data_model)
+                                            .find_first_child_of_class("ReplicatedStorage");
 
         if (!replicated_storage.is_valid()) {
             LOG_ERR("Could not find 'ReplicatedStorage' inside data model.");
@@ -21,7 +21,8 @@ namespace scanner::phases {
         const auto string_value = replicated_storage.find_first_child("Value");
 
         const auto value_offset =
-            memory->find_roblox_string_direct(string_value.address, "hello world", 0x800, 0x8);
+            ctx.memory->find_roblox_string_direct(string_value.address, "hello world", 0x800, 0x8,
+                                                  offset_registry.seed("Value", "Value"));
 
         if (!value_offset) {
             LOG_ERR("Failed to get Value offset");
@@ -8,49 +8,55 @@ namespace scanner::phases {
 
     inline bool visual_engine(Context& ctx) {
         const auto visual_engine_pointer =
-            memory->find_pointer_by_rtti("VisualEngine@Graphics@RBX");
+            ctx.memory->find_pointer_by_rtti("VisualEngine@Graphics@RBX", 0x10000000, 0x8,
+                                             offset_registry.seed("VisualEngine", "Pointer"));
         if (!visual_engine_pointer) {
             LOG_ERR("Failed to find VisualEngine Pointer");
             return false;
         }
 
         ctx.visual_engine =
-            memory->read<uintptr_t>(memory->base_address() + *visual_engine_pointer);
+            ctx.memory->read<uintptr_t>(ctx.memory->base_address() + *visual_engine_pointer);
         if (!ctx.visual_engine) {
             LOG_ERR("Failed to read VisualEngine pointer at module offset 0x{:X} (addr 0x{:X})",
-                    *visual_engine_pointer, memory->base_address() + *visual_engine_pointer);
+                    *visual_engine_pointer, ctx.memory->base_address() + *visual_engine_pointer);
             return false;
         }
 
         offset_registry.add("VisualEngine", "Pointer", *visual_engine_pointer);
 
         auto render_view_offset =
-            memory->find_rtti_offset(ctx.visual_engine, "RenderView@Graphics@RBX");
+            ctx.memory->find_rtti_offset(ctx.visual_engine, "RenderView@Graphics@RBX", 0x1000, 0x8,
+                                         offset_registry.seed("VisualEngine", "RenderView"));
         if (!render_view_offset) {
             LOG_ERR("Failed to find RenderView offset");
             return false;
         }
         offset_registry.add("VisualEngine", "RenderView", *render_view_offset);
 
-        auto render_view = memory->read<uintptr_t>(ctx.visual_engine + *render_view_offset);
+        auto render_view = ctx.memory->read<uintptr_t>(ctx.visual_engine + *render_view_offset);
         if (!render_view) {
             LOG_ERR("Failed to read RenderView pointer");
             return false;
         }
 
         auto invalidate_lighting =
-            memory->find_value_offset<uint32_t>(render_view, 257, 0x1000, 0x2);
+            ctx.memory->find_value_offset<uint32_t>(
+                render_view, 257, 0x1000, 0x2, 0, {},
+                offset_registry.seed("RenderView", "InvalidateLighting"));
         if (!invalidate_lighting) {
             LOG_ERR("Failed to find InvalidateLighting offset");
         }
         offset_registry.add("RenderView", "InvalidateLighting", *invalidate_lighting);
 
-        auto [window_width, window_height] = memory->get_window_dimensions();
+        auto [window_width, window_height] = ctx.memory->get_window_dimensions();
         if (window_width > 0 && window_height > 0) {
-            auto dimensions_x_offset = memory->find_value_offset<float>(
-                ctx.visual_engine, static_cast<float>(window_width), 0x1000, 0x4);
+            auto dimensions_x_offset = ctx.memory->find_value_offset<float>(
+                ctx.visual_engine, static_cast<float>(window_width), 0x1000, 0x4, 0, {},
+                offset_registry.seed("VisualEngine", "WindowDimensions"));
             if (dimensions_x_offset) {
-                float y_value = memory->read<float>(ctx.visual_engine + *dimensions_x_offset + 0x4);
+                float y_value =
+                    ctx.memory->read<float>(ctx.visual_engine + *dimensions_x_offset + 0x4);
                 if (std::abs(y_value - static_cast<float>(window_height)) < 5.0f) {
                     offset_registry.add("VisualEngine", "WindowDimensions", *dimensions_x_offset);
                 } else {
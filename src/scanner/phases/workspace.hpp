@@ -9,14 +9,15 @@
 namespace scanner::phases {
 
     inline bool workspace(Context& ctx) {
-        control::Controller controller("http://localhost:8000");
+        auto& controller = control::shared_controller();
 
         if (!ctx.workspace.is_valid()) {
             LOG_ERR("Workspace not valid");
             return false;
         }
 
-        auto camera = memory->find_rtti_offset(ctx.workspace.address, "Camera@RBX");
+        auto camera = ctx.memory->find_rtti_offset(ctx.workspace.address, "Camera@RBX", 0x1000, 0x8,
+                                                   offset_registry.seed("Workspace", "Camera"));
         if (!camera) {
             LOG_ERR("Failed to find Camera offset");
             return false;
@@ -27,13 +28,12 @@ namespace scanner::phases {
 
         std::vector<float> gravity_values = {196.2f, 50.0f};
 
-        auto gravity_offsets = memory->find_offsets_with_snapshots<float>(
+        auto gravity_offsets = ctx.memory->find_offsets_with_snapshots<float>(
             ctx.workspace.address, gravity_values,
             [&](size_t i) {
                 controller.set_gravity(gravity_values[i]);
-                std::this_thread::sleep_for(std::chrono::milliseconds(400));
             },
-            0x1000, 0x4, 2000);
+            0x1000, 0x4, 2400);
 
         if (gravity_offsets.empty()) {
             LOG_ERR("Failed to find Gravity offset");
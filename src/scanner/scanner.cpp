@@ -29,13 +29,44 @@
 #include "phases/value.hpp"
 #include "phases/visual_engine.hpp"
 #include "phases/workspace.hpp"
+#include "utils/checkpoint.hpp"
 
 namespace scanner {
 
-    bool run_all_phases() {
-        Context ctx;
-        PhaseRegistry registry;
+    // Re-derives the Context pointers that the VisualEngine and DataModel phases would have
+    // set, from offsets restored out of a checkpoint.
+    static bool restore_context(Context& ctx, const std::vector<std::string>& completed) {
+        auto done = [&](const char* phase) {
+            return std::find(completed.begin(), completed.end(), phase) != completed.end();
+        };
+
+        if (done("VisualEngine")) {
+            ctx.visual_engine = ctx.memory->read<uintptr_t>(
+                ctx.memory->base_address() + sdk::offsets::VisualEngine::Pointer);
+            if (!ctx.visual_engine) {
+                LOG_ERR("Failed to restore VisualEngine from checkpoint");
+                return false;
+            }
+        }
 
+        if (done("DataModel")) {
+            uintptr_t fake_dm = ctx.memory->read<uintptr_t>(
+                ctx.visual_engine + sdk::offsets::VisualEngine::ToFakeDataModel);
+            ctx.data_model = ctx.memory->read<uintptr_t>(
+                fake_dm + sdk::offsets::VisualEngine::FakeToRealDataModel);
+            uintptr_t workspace = ctx.memory->read<uintptr_t>(
+                ctx.data_model + sdk::offsets::DataModel::Workspace);
+            if (!fake_dm || !ctx.data_model || !workspace) {
+                LOG_ERR("Failed to restore DataModel from checkpoint");
+                return false;
+            }
+            ctx.workspace = sdk::instance_t(ctx.memory, workspace);
+        }
+
+        return true;
+    }
+
+    static void register_phases(PhaseRegistry& registry) {
         registry.register_phase("VisualEngine", phases::visual_engine);
         registry.register_phase("DataModel", phases::data_model);
         registry.register_phase("Instance", phases::instance);
@@ -68,8 +99,59 @@ namespace scanner {
 
         // this phase also gets view matrix for VisualEngine
         registry.register_phase("Camera", phases::camera);
+    }
+
+    std::vector<std::string> phase_names() {
+        PhaseRegistry registry;
+        register_phases(registry);
+        return registry.names();
+    }
+
+    bool run_all_phases(Memory& memory, const RunOptions& options) {
+        Context ctx;
+        ctx.memory = &memory;
+        PhaseRegistry registry;
+        register_phases(registry);
+
+        checkpoint::State state;
+        state.roblox_version = offset_registry.get_roblox_version();
+        state.process_id = memory.process_id;
+
+        if (options.resume) {
+            auto saved = checkpoint::load(options.checkpoint_path);
+            if (!saved) {
+                LOG_WARN("No checkpoint at {}, running every phase", options.checkpoint_path);
+            } else {
+                offset_registry.restore(saved->offsets);
+                if (!restore_context(ctx, saved->completed_phases))
+                    return false;
+                state.completed_phases = saved->completed_phases;
+                LOG_INFO("Resuming: {} of {} phases already done", state.completed_phases.size(),
+                         registry.size());
+            }
+        }
+
+        auto on_complete = [&](const std::string& name) {
+            if (options.checkpoint_path.empty())
+                return;
+            state.completed_phases.push_back(name);
+            state.offsets = offset_registry.to_dump();
+            checkpoint::save(options.checkpoint_path, state);
+        };
+
+        std::vector<std::string> selected;
+        if (!options.phases.empty()) {
+            selected = BASE_PHASES;
+            selected.insert(selected.end(), options.phases.begin(), options.phases.end());
+        }
+
+        const auto skip = state.completed_phases;
+        if (!registry.run_all(ctx, skip, on_complete, selected))
+            return false;
 
-        return registry.run_all(ctx);
+        if (!options.checkpoint_path.empty())
+            checkpoint::remove(options.checkpoint_path);
+        return true;
     }
 
 } // namespace scanner
@@ -1,21 +1,40 @@
 #pragma once
 #include "memory/memory.h"
 #include "sdk/instance.hpp"
+#include "utils/event_log.hpp"
 #include "utils/logger.hpp"
 #include "utils/offset_registry.hpp"
+#include <algorithm>
 #include <functional>
 #include <string>
 #include <vector>
 
 namespace scanner {
 
+    // Everything a phase reads goes through ctx.memory, so two scans with their own Memory (two
+    // clients, or a client and a snapshot) can run side by side.
     struct Context {
+        Memory* memory = nullptr;
         uintptr_t visual_engine = 0;
         uintptr_t data_model = 0;
         sdk::instance_t workspace;
     };
 
     using ScanPhase = std::function<bool(Context&)>;
+    using PhaseCallback = std::function<void(const std::string&)>;
+
+    // Phases every other phase builds on (the Context pointers and Instance layout); they run
+    // even when RunOptions::phases leaves them out.
+    inline const std::vector<std::string> BASE_PHASES = {"VisualEngine", "DataModel", "Instance"};
+
+    struct RunOptions {
+        // written after every successful phase; empty disables checkpointing
+        std::string checkpoint_path;
+        // skip the phases recorded in checkpoint_path and rebuild the Context from its offsets
+        bool resume = false;
+        // run only these (and BASE_PHASES); empty runs all. Names must come from phase_names().
+        std::vector<std::string> phases;
+    };
 
     class PhaseRegistry {
       private:
@@ -26,17 +45,49 @@ namespace scanner {
             phases.push_back({name, phase});
         }
 
-        bool run_all(Context& ctx) {
-            for (const auto& [name, phase] : phases) {
+        size_t size() const { return phases.size(); }
+
+        std::vector<std::string> names() const {
+            std::vector<std::string> result;
+            for (const auto& [name, phase] : phases)
+                result.push_back(name);
+            return result;
+        }
+
+        // Phases in skip are already done; with a non-empty selected, phases not in it are left
+        // out altogether.
+        bool run_all(Context& ctx, const std::vector<std::string>& skip = {},
+                     const PhaseCallback& on_complete = nullptr,
+                     const std::vector<std::string>& selected = {}) {
+            for (size_t i = 0; i < phases.size(); i++) {
+                const auto& [name, phase] = phases[i];
+                if (!selected.empty() &&
+                    std::find(selected.begin(), selected.end(), name) == selected.end()) {
+                    LOG_DEBUG("Phase: {} (not selected)", name);
+                    continue;
+                }
+                if (std::find(skip.begin(), skip.end(), name) != skip.end()) {
+                    LOG_INFO("Phase: {} (already done)", name);
+                    continue;
+                }
+
                 LOG_INFO("Phase: {}", name);
+                OffsetRegistry::PhaseScope scope(static_cast<uint32_t>(i));
+                event_log::Phase event(i, name);
                 if (!phase(ctx)) {
                     LOG_ERR("Phase {} failed", name);
                     return false;
                 }
+                event.finish(true);
+
+                if (on_complete)
+                    on_complete(name);
             }
             return true;
         }
     };
 
-    bool run_all_phases();
+    // every phase, in the order run_all_phases runs them
+    std::vector<std::string> phase_names();
+    bool run_all_phases(Memory& memory, const RunOptions& options = {});
 } // namespace scanner
\ No newline at end of file
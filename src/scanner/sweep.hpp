@@ -0,0 +1,142 @@
+#pragma once
+#include "control/control.hpp"
+#include "memory/memory.h"
+#include "scanner.hpp"
+#include "utils/logger.hpp"
+#include "utils/offset_registry.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace scanner {
+
+    // StringValue the bridge keeps in ReplicatedStorage; reads "<token>:<step>" once step of
+    // sweep <token> has been applied
+    inline constexpr const char* SWEEP_MARKER = "SweepFrame";
+
+    // Snapshot scan in lockstep with the game. The bridge gets the whole list of values as one
+    // "sweep" command and applies one per frame, bumping SweepFrame after each. This side
+    // watches SweepFrame and snapshots [address, address + max_offset) every time it moves, so
+    // N values cost about N frames instead of N round-trips and sleeps. Steps that go by
+    // between two reads are skipped; a snapshot is only used if the marker has not moved on
+    // while it was taken.
+    //
+    // steps[i] is the data for action that makes the property read expected[i]. Returns the
+    // candidates that matched every observed step, the hint first if it is one of them. Returns
+    // nullopt when a lockstep sweep is not possible (the Value phase has not run, no marker, or
+    // the observed steps did not cover two different values) so the caller can fall back to
+    // find_offsets_with_snapshots.
+    template <typename T>
+    std::optional<std::vector<size_t>>
+    sweep_offsets(const Context& ctx, uintptr_t address, const std::string& action,
+                  const std::vector<nlohmann::json>& steps, const std::vector<T>& expected,
+                  size_t max_offset, size_t alignment, std::optional<size_t> hint = std::nullopt,
+                  int timeout_ms = 3000) {
+        if (steps.size() != expected.size() || steps.size() < 2)
+            return std::nullopt;
+
+        uintptr_t value_offset = sdk::offsets::Value::Value;
+        auto marker = sdk::instance_t(ctx.memory, ctx.data_model)
+                          .find_first_child("ReplicatedStorage")
+                          .find_first_child(SWEEP_MARKER);
+        if (!value_offset || !marker.is_valid()) {
+            LOG_WARN("No {} marker to sweep against", SWEEP_MARKER);
+            return std::nullopt;
+        }
+
+        // small enough that Luau prints it as a plain integer
+        static std::atomic<uint32_t> next_token{
+            uint32_t(std::chrono::steady_clock::now().time_since_epoch().count() % 900000) +
+            100000};
+        uint32_t token = next_token++;
+        std::string prefix = std::to_string(token) + ":";
+
+        auto observed_step = [&]() -> size_t {
+            std::string value = ctx.memory->read_roblox_string(marker.address + value_offset);
+            if (value.rfind(prefix, 0) != 0)
+                return 0;
+            size_t step = 0;
+            std::from_chars(value.data() + prefix.size(), value.data() + value.size(), step);
+            return step;
+        };
+
+        nlohmann::json sweep_steps = nlohmann::json::array();
+        for (const auto& data : steps)
+            sweep_steps.push_back({{"action", action}, {"data", data}});
+
+        auto& controller = control::shared_controller();
+        std::string command_id =
+            controller.send_command("sweep", {{"token", token}, {"steps", sweep_steps}});
+        if (command_id.empty())
+            return std::nullopt;
+
+        std::vector<size_t> candidates;
+        size_t last_step = 0;
+        size_t snapshots = 0;
+        // distinct expected values the snapshots saw; steps 1, 3, 5 of {1, 0, 1, 0, 1, 0} alone
+        // never rule out a static byte that happens to be 1
+        std::vector<T> observed_values;
+        std::vector<uint8_t> window;
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (last_step < steps.size() && std::chrono::steady_clock::now() < deadline) {
+            size_t step = observed_step();
+            if (step <= last_step || step > steps.size()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                continue;
+            }
+
+            window = ctx.memory->read_bytes(address, max_offset);
+            if (window.size() < max_offset || observed_step() != step) {
+                // unreadable, or the next step landed mid-read; try again on the next one
+                last_step = step;
+                continue;
+            }
+            last_step = step;
+
+            const T& value = expected[step - 1];
+            if (std::find(observed_values.begin(), observed_values.end(), value) ==
+                observed_values.end())
+                observed_values.push_back(value);
+            auto matches = [&](size_t offset) {
+                T current;
+                std::memcpy(&current, window.data() + offset, sizeof(T));
+                return current == value;
+            };
+
+            if (snapshots++ == 0) {
+                for (size_t offset = 0; offset + sizeof(T) <= max_offset; offset += alignment) {
+                    if (matches(offset))
+                        candidates.push_back(offset);
+                }
+            } else {
+                std::erase_if(candidates, [&](size_t offset) { return !matches(offset); });
+            }
+        }
+
+        auto result = controller.wait_for_completion(command_id, timeout_ms);
+        if (!result || result->status != "completed")
+            LOG_WARN("Sweep {} did not complete cleanly", token);
+
+        if (observed_values.size() < 2) {
+            LOG_WARN("Sweep {} only observed {} of {} steps ({} distinct values)", token,
+                     snapshots, steps.size(), observed_values.size());
+            return std::nullopt;
+        }
+
+        if (hint) {
+            auto it = std::find(candidates.begin(), candidates.end(), *hint);
+            if (it != candidates.end())
+                std::rotate(candidates.begin(), it, it + 1);
+        }
+        return candidates;
+    }
+
+} // namespace scanner
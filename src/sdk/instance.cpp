@@ -27,7 +27,7 @@ namespace sdk {
 
     std::vector<instance_t> instance_t::get_children() const {
         std::vector<instance_t> children;
-        if (!address)
+        if (!is_valid())
             return children;
 
         const auto start = memory->read<uintptr_t>(address + offsets::Instance::ChildrenStart);
@@ -37,7 +37,7 @@ namespace sdk {
         const auto end = memory->read<uintptr_t>(start + offsets::Instance::ChildrenEnd);
         for (auto node = memory->read<uintptr_t>(start); node != end; node += 0x10) {
             if (const auto child_addr = memory->read<uintptr_t>(node))
-                children.emplace_back(child_addr);
+                children.emplace_back(memory, child_addr);
         }
         return children;
     }
@@ -64,10 +64,10 @@ namespace sdk {
 
     instance_t instance_t::get_parent() const {
         if (!is_valid())
-            return instance_t(0);
+            return {};
         const std::uint64_t parent_addr =
             memory->read<uintptr_t>(address + offsets::Instance::Parent);
-        return instance_t(parent_addr);
+        return instance_t(memory, parent_addr);
     }
 
     std::size_t instance_t::get_children_count() const {
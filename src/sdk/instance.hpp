@@ -3,13 +3,17 @@
 #include <string>
 #include <vector>
 
+class Memory;
+
 namespace sdk {
+    // An Instance inside the process memory reads from; children and parents share it.
     class instance_t {
       public:
+        Memory* memory = nullptr;
         std::uint64_t address = 0;
 
         instance_t() = default;
-        explicit instance_t(std::uint64_t addr) : address(addr) {}
+        instance_t(Memory* mem, std::uint64_t addr) : memory(mem), address(addr) {}
 
         std::string get_name() const;
         std::string get_class_name() const;
@@ -19,6 +23,6 @@ namespace sdk {
         instance_t get_parent() const;
         std::size_t get_children_count() const;
 
-        bool is_valid() const { return address != 0; }
+        bool is_valid() const { return memory && address != 0; }
     };
 } // namespace sdk
\ No newline at end of file
@@ -1,17 +1,47 @@
 #pragma once
+#include <atomic>
 #include <cstdint>
+#include <string_view>
+
+// Offsets the SDK and later phases read back while the dump is still running, as
+// (namespace, name) pairs. Each becomes sdk::offsets::<namespace>::<name>, and OffsetRegistry::add
+// stores into it as soon as the offset is discovered, so adding a line here is all it takes to
+// make another offset available that way.
+#define SDK_OFFSETS(X)                                                                             \
+    X(Instance, ClassDescriptor)                                                                   \
+    X(Instance, Parent)                                                                            \
+    X(Instance, Name)                                                                              \
+    X(Instance, ClassName)                                                                         \
+    X(Instance, ChildrenStart)                                                                     \
+    X(Instance, ChildrenEnd)                                                                       \
+    X(VisualEngine, Pointer)                                                                       \
+    X(VisualEngine, ToFakeDataModel)                                                               \
+    X(VisualEngine, FakeToRealDataModel)                                                           \
+    X(DataModel, Workspace)                                                                        \
+    X(Value, Value)                                                                                \
+    X(ByteCode, Size)
 
 namespace sdk {
     namespace offsets {
 
-        namespace Instance {
-            inline uintptr_t ClassDescriptor = 0;
-            inline uintptr_t Parent = 0;
-            inline uintptr_t Name = 0;
-            inline uintptr_t ClassName = 0;
-            inline uintptr_t ChildrenStart = 0;
-            inline uintptr_t ChildrenEnd = 0;
-        } // namespace Instance
+        // atomic because phases may discover an offset on one thread while another reads it;
+        // the loads compile to plain moves on x86
+#define SDK_DECLARE_OFFSET(ns, name)                                                               \
+    namespace ns {                                                                                 \
+        inline std::atomic<uintptr_t> name{0};                                                     \
+    }
+        SDK_OFFSETS(SDK_DECLARE_OFFSET)
+#undef SDK_DECLARE_OFFSET
+
+        struct Binding {
+            std::string_view ns;
+            std::string_view name;
+            std::atomic<uintptr_t>* target;
+        };
+
+#define SDK_BIND_OFFSET(ns, name) Binding{#ns, #name, &ns::name},
+        inline constexpr Binding BINDINGS[] = {SDK_OFFSETS(SDK_BIND_OFFSET)};
+#undef SDK_BIND_OFFSET
 
     } // namespace offsets
-} // namespace sdk
\ No newline at end of file
+} // namespace sdk
@@ -0,0 +1,76 @@
+#pragma once
+#include "utils/logger.hpp"
+#include "utils/offset_file.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Progress of a dump that is still running, written after every successful phase. Pointers into
+// the client are only valid for the process that produced them, so a checkpoint is keyed by
+// Roblox version and PID and cannot be resumed against a restarted client.
+namespace checkpoint {
+
+    struct State {
+        std::string roblox_version;
+        uint32_t process_id = 0;
+        std::vector<std::string> completed_phases;
+        offset_file::Dump offsets;
+    };
+
+    inline std::string path_for(const std::string& directory, const std::string& roblox_version,
+                                uint32_t process_id) {
+        std::string version = roblox_version.empty() ? "unknown" : roblox_version;
+        return (std::filesystem::path(directory) /
+                (version + "-" + std::to_string(process_id) + ".json"))
+            .string();
+    }
+
+    inline bool save(const std::string& path, const State& state) {
+        nlohmann::ordered_json j;
+        j["metadata"]["roblox_version"] = state.roblox_version;
+        j["metadata"]["process_id"] = state.process_id;
+        j["metadata"]["completed_phases"] = state.completed_phases;
+        j["offsets"] = offset_file::offsets_to_json(state.offsets);
+
+        return offset_file::write_atomic(path, j.dump(4) + "\n");
+    }
+
+    inline std::optional<State> load(const std::string& path) {
+        std::error_code ec;
+        if (!std::filesystem::exists(path, ec))
+            return std::nullopt;
+
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            LOG_ERR("Failed to open checkpoint: {}", path);
+            return std::nullopt;
+        }
+
+        try {
+            auto j = nlohmann::ordered_json::parse(file);
+            const auto& metadata = j.at("metadata");
+
+            State state;
+            state.roblox_version = metadata.at("roblox_version").get<std::string>();
+            state.process_id = metadata.at("process_id").get<uint32_t>();
+            state.completed_phases =
+                metadata.at("completed_phases").get<std::vector<std::string>>();
+            state.offsets.roblox_version = state.roblox_version;
+            offset_file::offsets_from_json(j.at("offsets"), state.offsets);
+            return state;
+        } catch (const std::exception& e) {
+            LOG_ERR("Failed to parse checkpoint {}: {}", path, e.what());
+            return std::nullopt;
+        }
+    }
+
+    inline void remove(const std::string& path) {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+} // namespace checkpoint
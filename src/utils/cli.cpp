@@ -0,0 +1,193 @@
+#include "cli.hpp"
+#include "logger.hpp"
+#include "offset_writer.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+namespace cli {
+    enum class EnvKind { Switch, Value, PathList };
+
+    struct EnvOption {
+        const char* variable;
+        const char* flag;
+        EnvKind kind;
+    };
+
+    static constexpr EnvOption ENV_OPTIONS[] = {
+        {"ROBLOX_DUMPER_SEED", "--seed", EnvKind::Value},
+        {"ROBLOX_DUMPER_NO_CACHE", "--no-cache", EnvKind::Switch},
+        {"ROBLOX_DUMPER_RESUME", "--resume", EnvKind::Switch},
+        {"ROBLOX_DUMPER_FORMATS", "--formats", EnvKind::Value},
+        {"ROBLOX_DUMPER_DIFF", "--diff", EnvKind::PathList},
+        {"ROBLOX_DUMPER_BATCH", "--batch", EnvKind::Switch},
+        {"ROBLOX_DUMPER_CONFIG", "--config", EnvKind::Value},
+        {"ROBLOX_DUMPER_PROCESS", "--process", EnvKind::Value},
+        {"ROBLOX_DUMPER_PHASES", "--phases", EnvKind::Value},
+        {"ROBLOX_DUMPER_OUTPUT", "--output", EnvKind::Value},
+    };
+
+    // separates the paths of a PathList variable, as in PATH
+#ifdef _WIN32
+    static constexpr char PATH_LIST_SEPARATOR = ';';
+#else
+    static constexpr char PATH_LIST_SEPARATOR = ':';
+#endif
+
+    static std::vector<std::string> split_list(const std::string& list, char separator = ',') {
+        std::vector<std::string> items;
+        for (size_t start = 0; start <= list.size();) {
+            size_t end = list.find(separator, start);
+            if (end == std::string::npos)
+                end = list.size();
+            items.push_back(list.substr(start, end - start));
+            start = end + 1;
+        }
+        return items;
+    }
+
+    // The environment's options as flags, followed by the real command line, so a flag given on
+    // the command line is parsed last and wins. A switch is on unless its variable is "0".
+    static std::vector<std::string> collect_args(int argc, char** argv) {
+        std::vector<std::string> args;
+        for (const auto& option : ENV_OPTIONS) {
+            const char* value = std::getenv(option.variable);
+            if (!value || !*value)
+                continue;
+            switch (option.kind) {
+                case EnvKind::Switch:
+                    if (std::string_view(value) != "0")
+                        args.push_back(option.flag);
+                    break;
+                case EnvKind::Value:
+                    args.push_back(option.flag);
+                    args.push_back(value);
+                    break;
+                case EnvKind::PathList:
+                    args.push_back(option.flag);
+                    for (auto& path : split_list(value, PATH_LIST_SEPARATOR)) {
+                        if (!path.empty())
+                            args.push_back(std::move(path));
+                    }
+                    break;
+            }
+        }
+        for (int i = 1; i < argc; i++)
+            args.push_back(argv[i]);
+        return args;
+    }
+
+    std::optional<Options> parse(int argc, char** argv) {
+        Options options;
+        auto args = collect_args(argc, argv);
+
+        // the value after args[i], or nullopt (and an error) if there is none
+        auto value = [&](size_t& i, const char* what) -> std::optional<std::string> {
+            if (i + 1 >= args.size()) {
+                LOG_ERR("{} requires {}", args[i], what);
+                return std::nullopt;
+            }
+            return args[++i];
+        };
+
+        for (size_t i = 0; i < args.size(); i++) {
+            const std::string& arg = args[i];
+
+            if (arg == "--seed") {
+                auto path = value(i, "a path to a previous offsets.json");
+                if (!path)
+                    return std::nullopt;
+                options.seed_path = *path;
+            } else if (arg == "--no-cache") {
+                options.no_cache = true;
+            } else if (arg == "--resume") {
+                options.resume = true;
+            } else if (arg == "--formats") {
+                auto list = value(i, "a comma-separated list, e.g. hpp,json,csv");
+                if (!list)
+                    return std::nullopt;
+                options.formats.clear();
+                for (const auto& format : split_list(*list)) {
+                    if (!offset_writer::make_sink(format)) {
+                        LOG_ERR("Unknown output format: {}", format);
+                        return std::nullopt;
+                    }
+                    options.formats.push_back(format);
+                }
+            } else if (arg == "--diff") {
+                options.diff_paths.clear();
+                while (i + 1 < args.size() && args[i + 1].rfind("--", 0) != 0)
+                    options.diff_paths.push_back(args[++i]);
+                if (options.diff_paths.empty()) {
+                    LOG_ERR("--diff requires at least one offsets.json or directory of them");
+                    return std::nullopt;
+                }
+            } else if (arg == "--batch") {
+                options.batch = true;
+            } else if (arg == "--config") {
+                auto path = value(i, "a path to a dumper-config.json");
+                if (!path)
+                    return std::nullopt;
+                options.config_path = *path;
+            } else if (arg == "--process") {
+                auto name = value(i, "a process name, e.g. RobloxPlayerBeta.exe");
+                if (!name)
+                    return std::nullopt;
+                options.process_name = *name;
+            } else if (arg == "--phases") {
+                // names are checked against the scanner in main
+                auto list = value(i, "a comma-separated list of phases, e.g. Humanoid,Camera");
+                if (!list)
+                    return std::nullopt;
+                options.phases = split_list(*list);
+            } else if (arg == "--output") {
+                auto path = value(i, "a directory");
+                if (!path)
+                    return std::nullopt;
+                options.output_dir = *path;
+            } else if (arg == "--help" || arg == "-h") {
+                options.help = true;
+                return options;
+            } else {
+                LOG_ERR("Unknown argument: {}", arg);
+                return std::nullopt;
+            }
+        }
+
+        return options;
+    }
+
+    void print_usage(const char* program) {
+        // whatever parse() logged goes above the usage text
+        Logger::flush();
+        std::cout << "Usage: " << program << " [options]\n\n";
+        std::cout << "  --seed <offsets.json>   verify offsets from a previous dump before\n";
+        std::cout << "                          searching; only stale ones are rescanned\n";
+        std::cout << "  --no-cache              ignore the dump cache and always run every phase\n";
+        std::cout << "  --resume                skip phases a failed run against this client\n";
+        std::cout << "                          already finished (see checkpoints/)\n";
+        std::cout << "  --formats <list>        output formats, comma-separated (default\n";
+        std::cout << "                          hpp,json,bin; also csv, rs, cs, py)\n";
+        std::cout << "  --diff <paths...>       diff offsets.json files (directories are read\n";
+        std::cout << "                          oldest first) into offsets_diff.json; a single\n";
+        std::cout << "                          dump is diffed against this run's dump\n";
+        std::cout << "  --batch                 never wait for input: fail instead of asking for\n";
+        std::cout << "                          a missing config, exit without waiting for Enter\n";
+        std::cout << "  --config <path>         config file (default dumper-config.json)\n";
+        std::cout << "  --process <name>        process to attach to (default\n";
+        std::cout << "                          RobloxPlayerBeta.exe)\n";
+        std::cout << "  --phases <list>         run only these phases, comma-separated, plus\n";
+        std::cout << "                          VisualEngine, DataModel and Instance\n";
+        std::cout << "  --output <dir>          write offsets, diff, log and events.bin to dir\n";
+        std::cout << "                          (default: next to the executable)\n";
+        std::cout << "  -h, --help              show this message\n\n";
+        std::cout << "Each option can also be set as ROBLOX_DUMPER_<OPTION>, e.g.\n";
+        std::cout << "ROBLOX_DUMPER_BATCH=1 or ROBLOX_DUMPER_NO_CACHE=1; the command line wins.\n";
+        std::cout << "ROBLOX_DUMPER_DIFF separates its paths like PATH does.\n";
+        std::cout << "Config fields come from ROBLOX_DUMPER_GAME_ID, _PLACE_ID, _CREATOR_ID,\n";
+        std::cout << "_USER_ID and _DISPLAY_NAME, or _PUBLISHED_GAME=1 for the published game's\n";
+        std::cout << "IDs, on top of the config file.\n\n";
+        std::cout << "Exit codes: 0 ok, 1 dump failed, 2 usage, 3 config, 4 attach,\n";
+        std::cout << "5 control server, 6 unreadable input, 7 output not written\n";
+    }
+} // namespace cli
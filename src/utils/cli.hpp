@@ -0,0 +1,50 @@
+#pragma once
+#include "utils/offset_writer.hpp"
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cli {
+    // What the process exits with, so a script can tell a bad setup from a failed dump.
+    enum ExitCode : int {
+        OK = 0,
+        // a phase failed; finished phases were checkpointed
+        DUMP_FAILED = 1,
+        USAGE = 2,
+        CONFIG = 3,
+        ATTACH = 4,
+        CONTROL_SERVER = 5,
+        // a --seed or --diff input could not be read
+        INPUT = 6,
+        OUTPUT = 7,
+    };
+
+    struct Options {
+        // previous offsets.json; its offsets are verified first and only searched for if stale
+        std::string seed_path;
+        // always run the phases, even if the dump cache has this build
+        bool no_cache = false;
+        // skip the phases a previous run against this client already finished
+        bool resume = false;
+        // output formats written next to offsets.hpp, see offset_writer::make_sink
+        std::vector<std::string> formats = offset_writer::DEFAULT_FORMATS;
+        // offsets.json files or directories of them to diff; a single dump is diffed against this
+        // run's dump, two or more against each other without attaching to Roblox
+        std::vector<std::string> diff_paths;
+        // never touch stdin: no config prompts (see config::init) and no "press Enter" at exit
+        bool batch = false;
+        std::string config_path = "dumper-config.json";
+        std::string process_name = "RobloxPlayerBeta.exe";
+        // run only these phases plus scanner::BASE_PHASES; empty runs every phase
+        std::vector<std::string> phases;
+        // where offsets.*, offsets_diff.json, dumper.log and events.bin go; empty is the
+        // executable's directory
+        std::string output_dir;
+        bool help = false;
+    };
+
+    // Every option can also come from the environment (ROBLOX_DUMPER_SEED, ROBLOX_DUMPER_BATCH=1,
+    // ...; see print_usage). The command line wins over the environment.
+    std::optional<Options> parse(int argc, char** argv);
+    void print_usage(const char* program);
+} // namespace cli
@@ -1,15 +1,25 @@
 #include "config.hpp"
 #include "logger.hpp"
 #include <algorithm>
+#include <charconv>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <string_view>
 
 namespace config {
     static Config g_config;
     static bool g_config_loaded = false;
 
+    static void use_published_game(Config& cfg) {
+        cfg.using_published_game = true;
+        cfg.game_id = 2647427431;
+        cfg.place_id = 6923982205;
+        cfg.creator_id = 2632766773;
+    }
+
     std::optional<Config> load_config(const std::string& filepath) {
         std::ifstream file(filepath);
         if (!file.is_open()) {
@@ -109,9 +119,7 @@ namespace config {
         cfg.using_published_game = using_published;
 
         if (using_published) {
-            cfg.game_id = 2647427431;
-            cfg.place_id = 6923982205;
-            cfg.creator_id = 2632766773;
+            use_published_game(cfg);
             std::cout << "\nUsing published game IDs:\n";
             std::cout << "  Game ID: " << cfg.game_id << "\n";
             std::cout << "  Place ID: " << cfg.place_id << "\n";
@@ -134,16 +142,94 @@ namespace config {
         return cfg;
     }
 
-    bool init(const std::string& filepath) {
+    // which parts of the config the ROBLOX_DUMPER_* variables provided
+    struct EnvFields {
+        bool ids = false;
+        bool user_id = false;
+        bool display_name = false;
+        bool any() const { return ids || user_id || display_name; }
+    };
+
+    static bool read_env_uint64(const char* variable, uint64_t& out, bool& found) {
+        const char* value = std::getenv(variable);
+        if (!value || !*value)
+            return true;
+        std::string_view text(value);
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            LOG_ERR("{} is not a number: {}", variable, text);
+            return false;
+        }
+        found = true;
+        return true;
+    }
+
+    static bool apply_env(Config& cfg, EnvFields& set) {
+        if (const char* published = std::getenv("ROBLOX_DUMPER_PUBLISHED_GAME");
+            published && *published && std::string_view(published) != "0") {
+            use_published_game(cfg);
+            set.ids = true;
+        }
+
+        bool game = false, place = false, creator = false;
+        if (!read_env_uint64("ROBLOX_DUMPER_GAME_ID", cfg.game_id, game) ||
+            !read_env_uint64("ROBLOX_DUMPER_PLACE_ID", cfg.place_id, place) ||
+            !read_env_uint64("ROBLOX_DUMPER_CREATOR_ID", cfg.creator_id, creator) ||
+            !read_env_uint64("ROBLOX_DUMPER_USER_ID", cfg.user_id, set.user_id)) {
+            return false;
+        }
+        if (game || place || creator) {
+            if (!set.ids && !(game && place && creator)) {
+                LOG_ERR("Set ROBLOX_DUMPER_GAME_ID, _PLACE_ID and _CREATOR_ID together");
+                return false;
+            }
+            cfg.using_published_game = false;
+            set.ids = true;
+        }
+
+        if (const char* name = std::getenv("ROBLOX_DUMPER_DISPLAY_NAME"); name && *name) {
+            cfg.display_name = name;
+            set.display_name = true;
+        }
+        return true;
+    }
+
+    bool init(const std::string& filepath, bool interactive) {
         auto loaded = load_config(filepath);
+        Config cfg = loaded.value_or(Config{});
+        EnvFields from_env;
+        if (!apply_env(cfg, from_env))
+            return false;
+
         if (loaded) {
-            g_config = *loaded;
+            g_config = cfg;
+            g_config_loaded = true;
+            LOG_INFO("Config loaded from {}{}", filepath,
+                     from_env.any() ? " (with ROBLOX_DUMPER_* overrides)" : "");
+            if (interactive)
+                LOG_INFO("If you're using a different config, delete '{}' and restart.", filepath);
+            return true;
+        }
+
+        if (from_env.any()) {
+            // nothing to fall back on, so the environment has to say everything; it is not saved
+            if (!from_env.ids || !from_env.user_id || !from_env.display_name) {
+                LOG_ERR("No config at {}; ROBLOX_DUMPER_* needs game IDs (or _PUBLISHED_GAME=1), "
+                        "_USER_ID and _DISPLAY_NAME",
+                        filepath);
+                return false;
+            }
+            g_config = cfg;
             g_config_loaded = true;
-            LOG_INFO("Config loaded from {}", filepath);
-            LOG_INFO("If you're using a different config, delete '{}' and restart.", filepath);
+            LOG_INFO("Config taken from ROBLOX_DUMPER_* variables");
             return true;
         }
 
+        if (!interactive) {
+            LOG_ERR("No config at {} and no ROBLOX_DUMPER_* config variables set", filepath);
+            return false;
+        }
+
         g_config = create_config();
         g_config_loaded = true;
 
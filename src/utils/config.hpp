@@ -20,7 +20,10 @@ namespace config {
 
     Config create_config();
 
-    bool init(const std::string& filepath = "dumper-config.json");
+    // Loads filepath, then applies the ROBLOX_DUMPER_* config variables on top. Without a file
+    // the variables have to describe a whole config; failing that, an interactive run asks for
+    // one (and saves it) while a non-interactive one fails.
+    bool init(const std::string& filepath = "dumper-config.json", bool interactive = true);
 
     const Config& get();
     void set(const Config& cfg);
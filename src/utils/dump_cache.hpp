@@ -0,0 +1,173 @@
+#pragma once
+#include "memory/memory.h"
+#include "utils/logger.hpp"
+#include "utils/offset_file.hpp"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Complete dump results keyed by Roblox version, so re-running against a build that was already
+// dumped only costs a fingerprint and a few spot reads. The version alone is not trusted: the
+// module's PE timestamp and section hashes have to match too.
+namespace dump_cache {
+
+    struct Fingerprint {
+        std::string roblox_version;
+        uint32_t pe_timestamp = 0;
+        std::map<std::string, uint64_t> section_hashes;
+
+        bool operator==(const Fingerprint&) const = default;
+    };
+
+    inline uint64_t fnv1a(const void* data, size_t size, uint64_t hash = 0xCBF29CE484222325ull) {
+        auto bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= 0x100000001B3ull;
+        }
+        return hash;
+    }
+
+    // Every section contributes its header; read-only data sections (.rdata and friends, which
+    // hold the RTTI names the scanner keys on) also contribute their contents. Code and writable
+    // sections are left out since their bytes are not stable while the client runs.
+    inline std::optional<Fingerprint> fingerprint(Memory& mem, const std::string& roblox_version) {
+        constexpr size_t CHUNK_SIZE = 0x10000;
+
+        auto nt = mem.get_nt_headers();
+        auto sections = mem.get_section_headers();
+        if (!nt || sections.empty()) {
+            LOG_ERR("Failed to read PE headers for the dump cache fingerprint");
+            return std::nullopt;
+        }
+
+        Fingerprint fp;
+        fp.roblox_version = roblox_version;
+        fp.pe_timestamp = nt->FileHeader.TimeDateStamp;
+
+        uintptr_t base = mem.base_address();
+        std::vector<uint8_t> chunk(CHUNK_SIZE);
+        for (const auto& sec : sections) {
+            char name[9]{};
+            std::memcpy(name, sec.Name, 8);
+
+            uint64_t hash = fnv1a(&sec, sizeof(sec));
+            if (!(sec.Characteristics & (IMAGE_SCN_MEM_EXECUTE | IMAGE_SCN_MEM_WRITE))) {
+                for (size_t offset = 0; offset < sec.Misc.VirtualSize; offset += CHUNK_SIZE) {
+                    size_t size = (std::min)(CHUNK_SIZE, size_t(sec.Misc.VirtualSize) - offset);
+                    if (!mem.read_raw(base + sec.VirtualAddress + offset, chunk.data(), size)) {
+                        LOG_ERR("Failed to read section {} at +0x{:X}", name, offset);
+                        return std::nullopt;
+                    }
+                    hash = fnv1a(chunk.data(), size, hash);
+                }
+            }
+            fp.section_hashes[name] = hash;
+        }
+        return fp;
+    }
+
+    inline std::string path_for(const std::string& directory, const std::string& roblox_version) {
+        return (std::filesystem::path(directory) / (roblox_version + ".json")).string();
+    }
+
+    // The cached offsets for fp.roblox_version, or nullopt on a miss or fingerprint mismatch.
+    inline std::optional<offset_file::Dump> load(const std::string& path, const Fingerprint& fp) {
+        std::error_code ec;
+        if (!std::filesystem::exists(path, ec))
+            return std::nullopt;
+
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            LOG_ERR("Failed to open dump cache: {}", path);
+            return std::nullopt;
+        }
+
+        try {
+            auto j = nlohmann::ordered_json::parse(file);
+            const auto& metadata = j.at("metadata");
+
+            Fingerprint cached;
+            cached.roblox_version = metadata.at("roblox_version").get<std::string>();
+            cached.pe_timestamp = metadata.at("pe_timestamp").get<uint32_t>();
+            for (const auto& [name, hash] : metadata.at("section_hashes").items())
+                cached.section_hashes[name] = hash.get<uint64_t>();
+
+            if (!(cached == fp)) {
+                LOG_WARN("Dump cache for {} does not match the running module, ignoring it",
+                         fp.roblox_version);
+                return std::nullopt;
+            }
+
+            offset_file::Dump dump;
+            dump.roblox_version = cached.roblox_version;
+            offset_file::offsets_from_json(j.at("offsets"), dump);
+            return dump;
+        } catch (const std::exception& e) {
+            LOG_ERR("Failed to parse dump cache {}: {}", path, e.what());
+            return std::nullopt;
+        }
+    }
+
+    inline bool store(const std::string& path, const Fingerprint& fp,
+                      const offset_file::Dump& dump) {
+        nlohmann::ordered_json j;
+        j["metadata"]["roblox_version"] = fp.roblox_version;
+        j["metadata"]["pe_timestamp"] = fp.pe_timestamp;
+        j["metadata"]["section_hashes"] = fp.section_hashes;
+
+        j["offsets"] = offset_file::offsets_to_json(dump);
+
+        return offset_file::write_atomic(path, j.dump(4) + "\n");
+    }
+
+    // Walks VisualEngine -> DataModel -> Workspace with the cached offsets, the same chain the
+    // first phases discover. If every hop lands on the expected class the cache is taken as is.
+    inline bool spot_check(Memory& mem, const offset_file::Dump& dump) {
+        auto follow = [&](uintptr_t address, std::optional<uintptr_t> offset,
+                          const std::string& expected_class) -> uintptr_t {
+            if (!address || !offset)
+                return 0;
+            uintptr_t pointer = mem.read<uintptr_t>(address + *offset);
+            if (pointer < 0x10000)
+                return 0;
+            auto rtti = mem.scan_rtti(pointer);
+            return rtti && rtti->name == expected_class ? pointer : 0;
+        };
+
+        uintptr_t visual_engine = follow(mem.base_address(), dump.find("VisualEngine", "Pointer"),
+                                         "VisualEngine@Graphics@RBX");
+        uintptr_t fake_dm =
+            follow(visual_engine, dump.find("VisualEngine", "ToFakeDataModel"), "DataModel@RBX");
+        uintptr_t data_model =
+            follow(fake_dm, dump.find("VisualEngine", "FakeToRealDataModel"), "DataModel@RBX");
+        uintptr_t workspace =
+            follow(data_model, dump.find("DataModel", "Workspace"), "Workspace@RBX");
+        if (!workspace) {
+            LOG_WARN("Dump cache spot check failed: VisualEngine -> Workspace chain is broken");
+            return false;
+        }
+
+        if (!follow(workspace, dump.find("Instance", "ClassDescriptor"),
+                    "ClassDescriptor@Reflection@RBX")) {
+            LOG_WARN("Dump cache spot check failed: Instance::ClassDescriptor");
+            return false;
+        }
+
+        auto name_offset = dump.find("Instance", "Name");
+        uintptr_t name_ptr = name_offset ? mem.read<uintptr_t>(workspace + *name_offset) : 0;
+        if (!name_ptr || mem.read_roblox_string(name_ptr) != "Workspace") {
+            LOG_WARN("Dump cache spot check failed: Instance::Name");
+            return false;
+        }
+
+        return true;
+    }
+
+} // namespace dump_cache
@@ -0,0 +1,449 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Compact binary record of what a dump did, for looking at its performance afterwards without
+// the game: phases, every find_* call with its parameters and result, how many reads each of
+// them issued, and controller requests with their latency. Records are appended to events.bin as
+// they happen; tools/event_log_decode.cpp turns the file into JSON or CSV. Standard library only,
+// so the decoder builds anywhere.
+//
+//   Header  "RDEV", u16 version, u16 reserved, u64 session start (unix ns)
+//   Record  u32 size of the rest of the record, u16 type, u16 thread, u64 ns since the start,
+//           then the fields SCHEMAS lists for the type
+//   Fields  u64 and f64 little-endian, bool one byte, optional one byte (present) + u64,
+//           string u32 length + bytes
+//
+// Readers skip record types they do not know by their size, so new types can be added without
+// a version bump. A run that crashed leaves at most a truncated last record.
+namespace event_log {
+
+    inline constexpr char MAGIC[4] = {'R', 'D', 'E', 'V'};
+    inline constexpr uint16_t VERSION = 1;
+    inline constexpr size_t HEADER_SIZE = 16;
+    // type, thread and time, after the size prefix
+    inline constexpr size_t RECORD_HEADER_SIZE = 12;
+
+    enum class Type : uint16_t { PhaseStart = 1, PhaseEnd = 2, Find = 3, Request = 4 };
+    enum class FieldType : uint8_t { U64, F64, Bool, OptionalU64, String };
+
+    struct Field {
+        std::string_view name;
+        FieldType type;
+    };
+
+    struct Schema {
+        Type type;
+        std::string_view name;
+        std::span<const Field> fields;
+    };
+
+    using enum FieldType;
+    inline constexpr Field PHASE_START_FIELDS[] = {{"index", U64}, {"name", String}};
+    inline constexpr Field PHASE_END_FIELDS[] = {
+        {"index", U64},        {"name", String},       {"ok", Bool},
+        {"duration_ns", U64},  {"reads", U64},         {"read_bytes", U64},
+        {"failed_reads", U64},
+    };
+    inline constexpr Field FIND_FIELDS[] = {
+        {"function", String},   {"base", U64},        {"max_offset", U64},
+        {"alignment", U64},     {"hint", OptionalU64}, {"target", String},
+        {"result", OptionalU64}, {"duration_ns", U64}, {"reads", U64},
+        {"read_bytes", U64},
+    };
+    inline constexpr Field REQUEST_FIELDS[] = {
+        {"method", String}, {"path", String}, {"action", String},
+        {"status", U64},    {"ok", Bool},     {"latency_ns", U64},
+    };
+
+    inline constexpr Schema SCHEMAS[] = {
+        {Type::PhaseStart, "phase_start", PHASE_START_FIELDS},
+        {Type::PhaseEnd, "phase_end", PHASE_END_FIELDS},
+        {Type::Find, "find", FIND_FIELDS},
+        {Type::Request, "request", REQUEST_FIELDS},
+    };
+
+    inline const Schema* schema_for(uint16_t type) {
+        for (const auto& schema : SCHEMAS) {
+            if (static_cast<uint16_t>(schema.type) == type)
+                return &schema;
+        }
+        return nullptr;
+    }
+
+    template <typename T> struct is_optional : std::false_type {};
+    template <typename T> struct is_optional<std::optional<T>> : std::true_type {};
+
+    template <typename T> void append_raw(std::string& out, const T& value) {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    // one field, encoded by its C++ type; the emitters below pass them in SCHEMAS order
+    template <typename T> void put(std::string& out, const T& value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            out.push_back(value ? 1 : 0);
+        } else if constexpr (std::is_integral_v<T>) {
+            append_raw(out, static_cast<uint64_t>(value));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            append_raw(out, static_cast<double>(value));
+        } else if constexpr (is_optional<T>::value) {
+            out.push_back(value ? 1 : 0);
+            append_raw(out, static_cast<uint64_t>(value.value_or(0)));
+        } else {
+            std::string_view text = value;
+            append_raw(out, static_cast<uint32_t>(text.size()));
+            out.append(text);
+        }
+    }
+
+    class Writer {
+      public:
+        // buffered records are written out once they pass this, and at every phase end
+        static constexpr size_t FLUSH_SIZE = 64 * 1024;
+
+        ~Writer() { close(); }
+
+        bool open(const std::string& path) {
+            std::lock_guard<std::mutex> lock(mutex);
+            file.open(path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+                return false;
+
+            start = std::chrono::steady_clock::now();
+            uint64_t session_start = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::system_clock::now().time_since_epoch())
+                                         .count();
+            buffer.append(MAGIC, sizeof(MAGIC));
+            append_raw(buffer, VERSION);
+            append_raw(buffer, uint16_t(0));
+            append_raw(buffer, session_start);
+            // release: emit() reads start without the lock
+            enabled_flag.store(true, std::memory_order_release);
+            return true;
+        }
+
+        void close() {
+            enabled_flag.store(false, std::memory_order_relaxed);
+            std::lock_guard<std::mutex> lock(mutex);
+            write_buffer();
+            file.close();
+        }
+
+        bool enabled() const { return enabled_flag.load(std::memory_order_acquire); }
+
+        template <typename... Fields> void emit(Type type, const Fields&... fields) {
+            if (!enabled())
+                return;
+
+            // encoded outside the lock into a per-thread scratch buffer that stops allocating
+            // after the first few records
+            thread_local std::string record;
+            record.clear();
+            append_raw(record, uint32_t(0));
+            append_raw(record, static_cast<uint16_t>(type));
+            append_raw(record, thread_index());
+            append_raw(record, static_cast<uint64_t>(
+                                   std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                       std::chrono::steady_clock::now() - start)
+                                       .count()));
+            (put(record, fields), ...);
+            uint32_t size = static_cast<uint32_t>(record.size() - sizeof(uint32_t));
+            std::memcpy(record.data(), &size, sizeof(size));
+
+            std::lock_guard<std::mutex> lock(mutex);
+            buffer += record;
+            if (buffer.size() >= FLUSH_SIZE)
+                write_buffer();
+        }
+
+        void flush() {
+            std::lock_guard<std::mutex> lock(mutex);
+            write_buffer();
+        }
+
+      private:
+        std::mutex mutex;
+        std::ofstream file;
+        std::string buffer;
+        std::chrono::steady_clock::time_point start;
+        std::atomic<bool> enabled_flag{false};
+
+        static uint16_t thread_index() {
+            static std::atomic<uint16_t> next{0};
+            thread_local uint16_t index = next.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+
+        void write_buffer() {
+            if (!file.is_open() || buffer.empty())
+                return;
+            file.write(buffer.data(), buffer.size());
+            file.flush();
+            buffer.clear();
+        }
+    };
+
+    inline Writer writer;
+
+    inline bool enabled() { return writer.enabled(); }
+
+    struct ReadCounters {
+        uint64_t reads = 0;
+        uint64_t bytes = 0;
+        uint64_t failed = 0;
+    };
+
+    // this thread's reads, for what a single find_* call cost
+    inline thread_local ReadCounters thread_reads;
+    // every thread's reads, for phase totals
+    inline std::atomic<uint64_t> total_reads{0};
+    inline std::atomic<uint64_t> total_read_bytes{0};
+    inline std::atomic<uint64_t> total_failed_reads{0};
+
+    // Called by Memory for every read it issues; nothing is counted while the log is closed.
+    inline void count_read(size_t size, bool ok) {
+        if (!enabled())
+            return;
+        thread_reads.reads++;
+        thread_reads.bytes += size;
+        total_reads.fetch_add(1, std::memory_order_relaxed);
+        total_read_bytes.fetch_add(size, std::memory_order_relaxed);
+        if (!ok) {
+            thread_reads.failed++;
+            total_failed_reads.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Records a find_* call when it goes out of scope. Set result before returning a match.
+    class Find {
+      public:
+        std::optional<uint64_t> result;
+
+        Find(std::string_view function, uintptr_t base, size_t max_offset, size_t alignment,
+             std::optional<size_t> hint = std::nullopt, std::string_view target = {})
+            : active(enabled()), function(function), base(base), max_offset(max_offset),
+              alignment(alignment), target(target) {
+            if (!active)
+                return;
+            if (hint)
+                this->hint = *hint;
+            reads_before = thread_reads;
+            start = std::chrono::steady_clock::now();
+        }
+
+        Find(const Find&) = delete;
+        Find& operator=(const Find&) = delete;
+
+        ~Find() {
+            if (!active)
+                return;
+            uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now() - start)
+                                    .count();
+            writer.emit(Type::Find, function, base, max_offset, alignment, hint, target, result,
+                        duration, thread_reads.reads - reads_before.reads,
+                        thread_reads.bytes - reads_before.bytes);
+        }
+
+      private:
+        bool active;
+        std::string_view function;
+        uintptr_t base;
+        size_t max_offset;
+        size_t alignment;
+        std::optional<uint64_t> hint;
+        std::string_view target;
+        ReadCounters reads_before;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    // Records a phase's start now and its end, with the reads every thread issued meanwhile,
+    // when finish() is called (or as a failure if it never is).
+    class Phase {
+      public:
+        Phase(size_t index, std::string_view name)
+            : index(index), name(name), start(std::chrono::steady_clock::now()),
+              reads(total_reads.load(std::memory_order_relaxed)),
+              read_bytes(total_read_bytes.load(std::memory_order_relaxed)),
+              failed_reads(total_failed_reads.load(std::memory_order_relaxed)) {
+            writer.emit(Type::PhaseStart, index, name);
+        }
+
+        Phase(const Phase&) = delete;
+        Phase& operator=(const Phase&) = delete;
+
+        ~Phase() {
+            if (!finished)
+                finish(false);
+        }
+
+        void finish(bool ok) {
+            finished = true;
+            uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now() - start)
+                                    .count();
+            writer.emit(Type::PhaseEnd, index, name, ok, duration,
+                        total_reads.load(std::memory_order_relaxed) - reads,
+                        total_read_bytes.load(std::memory_order_relaxed) - read_bytes,
+                        total_failed_reads.load(std::memory_order_relaxed) - failed_reads);
+            writer.flush();
+        }
+
+      private:
+        size_t index;
+        std::string_view name;
+        std::chrono::steady_clock::time_point start;
+        uint64_t reads;
+        uint64_t read_bytes;
+        uint64_t failed_reads;
+        bool finished = false;
+    };
+
+    inline void request(std::string_view method, std::string_view path, std::string_view action,
+                        long status, bool ok, double latency_ms) {
+        writer.emit(Type::Request, method, path, action, static_cast<uint64_t>(status), ok,
+                    static_cast<uint64_t>(latency_ms * 1e6));
+    }
+
+    // Decoding, for tools/event_log_decode.cpp and anything else that wants to read a log.
+
+    struct Value {
+        FieldType type = FieldType::U64;
+        uint64_t u64 = 0;
+        double f64 = 0;
+        // Bool's value, or whether an OptionalU64 is set
+        bool flag = false;
+        std::string_view text;
+    };
+
+    struct Event {
+        uint16_t type = 0;
+        uint16_t thread = 0;
+        uint64_t time_ns = 0;
+        // null for a type this build does not know; values is empty then
+        const Schema* schema = nullptr;
+        std::vector<Value> values;
+    };
+
+    class Reader {
+      public:
+        uint64_t session_start_ns = 0;
+        // set when the data ended inside a record or a record did not match its schema
+        bool truncated = false;
+
+        // data has to outlive the reader and the events it returns
+        bool open(const void* data, size_t size) {
+            bytes = static_cast<const char*>(data);
+            end = bytes + size;
+            if (size < HEADER_SIZE || std::memcmp(bytes, MAGIC, sizeof(MAGIC)) != 0)
+                return false;
+            uint16_t version = load<uint16_t>(bytes + 4);
+            if (version != VERSION)
+                return false;
+            session_start_ns = load<uint64_t>(bytes + 8);
+            cursor = bytes + HEADER_SIZE;
+            return true;
+        }
+
+        std::optional<Event> next() {
+            if (cursor == end)
+                return std::nullopt;
+            if (end - cursor < 4) {
+                truncated = true;
+                return std::nullopt;
+            }
+            uint32_t size = load<uint32_t>(cursor);
+            const char* record = cursor + 4;
+            if (size < RECORD_HEADER_SIZE || uint64_t(end - record) < size) {
+                truncated = true;
+                return std::nullopt;
+            }
+            cursor = record + size;
+
+            Event event;
+            event.type = load<uint16_t>(record);
+            event.thread = load<uint16_t>(record + 2);
+            event.time_ns = load<uint64_t>(record + 4);
+            event.schema = schema_for(event.type);
+            if (!event.schema)
+                return event;
+
+            const char* field = record + RECORD_HEADER_SIZE;
+            const char* record_end = record + size;
+            for (const auto& schema_field : event.schema->fields) {
+                Value value;
+                value.type = schema_field.type;
+                if (!read_field(field, record_end, value)) {
+                    truncated = true;
+                    return std::nullopt;
+                }
+                event.values.push_back(value);
+            }
+            return event;
+        }
+
+      private:
+        const char* bytes = nullptr;
+        const char* cursor = nullptr;
+        const char* end = nullptr;
+
+        template <typename T> static T load(const char* at) {
+            T value;
+            std::memcpy(&value, at, sizeof(T));
+            return value;
+        }
+
+        static bool read_field(const char*& at, const char* limit, Value& value) {
+            auto take = [&](size_t bytes) {
+                if (size_t(limit - at) < bytes)
+                    return false;
+                at += bytes;
+                return true;
+            };
+            switch (value.type) {
+                case FieldType::U64:
+                    if (!take(8))
+                        return false;
+                    value.u64 = load<uint64_t>(at - 8);
+                    return true;
+                case FieldType::F64:
+                    if (!take(8))
+                        return false;
+                    value.f64 = load<double>(at - 8);
+                    return true;
+                case FieldType::Bool:
+                    if (!take(1))
+                        return false;
+                    value.flag = at[-1] != 0;
+                    return true;
+                case FieldType::OptionalU64:
+                    if (!take(9))
+                        return false;
+                    value.flag = at[-9] != 0;
+                    value.u64 = load<uint64_t>(at - 8);
+                    return true;
+                case FieldType::String: {
+                    if (!take(4))
+                        return false;
+                    uint32_t length = load<uint32_t>(at - 4);
+                    if (!take(length))
+                        return false;
+                    value.text = {at - length, length};
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+} // namespace event_log
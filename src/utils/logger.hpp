@@ -1,12 +1,21 @@
 #pragma once
+#include "mpsc_queue.hpp"
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstring>
 #include <format>
-#include <iomanip>
+#include <fstream>
 #include <iostream>
 #include <mutex>
-#include <sstream>
-#define NOMINMAX
-#include <Windows.h>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#ifdef _WIN32
+    #define NOMINMAX
+    #include <Windows.h>
+#endif
 
 #define COLOR_DEBUG "\033[90m"
 #define COLOR_INFO "\033[94m"
@@ -15,84 +24,291 @@
 #define COLOR_ERR "\033[91m"
 #define COLOR_RESET "\033[0m"
 
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_SUCCESS 2
+#define LOG_LEVEL_WARN 3
+#define LOG_LEVEL_ERR 4
+
+// LOG_* calls below this level compile to nothing, arguments included. Release builds drop
+// LOG_DEBUG unless the build defines LOG_MIN_LEVEL itself.
+#ifndef LOG_MIN_LEVEL
+    #ifdef NDEBUG
+        #define LOG_MIN_LEVEL LOG_LEVEL_INFO
+    #else
+        #define LOG_MIN_LEVEL LOG_LEVEL_DEBUG
+    #endif
+#endif
+
+// A log call never waits on the console. It stamps the time, builds a record and pushes it onto a
+// lock-free MPSC queue; a background thread drains the queue in batches to the console and, after
+// set_file(), to a log file. When every argument is a plain number the call does not even format:
+// it copies the arguments into the record and the writer thread formats them.
 class Logger {
-private:
-  inline static std::mutex mtx{};
-
-  static std::string timestamp() {
-    using namespace std::chrono;
-
-    auto now = system_clock::now();
-    auto local_time = current_zone()->to_local(now);
-    auto dp = floor<days>(local_time);
-    auto time = local_time - dp;
-
-    auto h = duration_cast<hours>(time);
-    auto m = duration_cast<minutes>(time - h);
-    auto s = duration_cast<seconds>(time - h - m);
-    auto ms = duration_cast<milliseconds>(time - h - m - s);
-
-    std::ostringstream oss;
-    oss << std::setfill('0') << std::setw(2) << h.count() << ':' << std::setw(2)
-        << m.count() << ':' << std::setw(2) << s.count() << '.' << std::setw(3)
-        << ms.count();
-    return oss.str();
-  }
-
-  static void write_log(const char *color, const char *level,
-                        const std::string &msg) {
-    std::lock_guard<std::mutex> lock(mtx);
-    std::cout << color << timestamp() << " [" << level << "] " << msg
-              << COLOR_RESET << std::endl;
-  }
-
-public:
-  template <typename... Args>
-  static void debug(std::format_string<Args...> fmt, Args &&...args) {
-    write_log(COLOR_DEBUG, "DEBUG",
-              std::format(fmt, std::forward<Args>(args)...));
-  }
-
-  template <typename... Args>
-  static void info(std::format_string<Args...> fmt, Args &&...args) {
-    write_log(COLOR_INFO, "INFO",
-              std::format(fmt, std::forward<Args>(args)...));
-  }
-
-  template <typename... Args>
-  static void success(std::format_string<Args...> fmt, Args &&...args) {
-    write_log(COLOR_SUCCESS, "SUCCESS",
-              std::format(fmt, std::forward<Args>(args)...));
-  }
-
-  template <typename... Args>
-  static void warn(std::format_string<Args...> fmt, Args &&...args) {
-    write_log(COLOR_WARN, "WARN",
-              std::format(fmt, std::forward<Args>(args)...));
-  }
-
-  template <typename... Args>
-  static void err(std::format_string<Args...> fmt, Args &&...args) {
-    write_log(COLOR_ERR, "ERR", std::format(fmt, std::forward<Args>(args)...));
-  }
+  public:
+    enum class Level { Debug, Info, Success, Warn, Err };
+
+  private:
+    // room for deferred arguments in a record; calls with more are formatted up front
+    static constexpr size_t DEFERRED_ARGS_SIZE = 48;
+
+    template <typename... Ts> struct ArgPack {};
+    template <typename T, typename... Rest> struct ArgPack<T, Rest...> {
+        T first;
+        ArgPack<Rest...> rest;
+    };
+
+    template <typename T> static constexpr bool deferrable = std::is_arithmetic_v<T>;
+
+    struct Record {
+        Level level = Level::Info;
+        std::chrono::system_clock::time_point time;
+        std::string message;
+        // deferred calls set these instead of message
+        std::string (*format)(std::string_view, const std::byte*) = nullptr;
+        std::string_view format_string;
+        alignas(std::max_align_t) std::byte args[DEFERRED_ARGS_SIZE];
+        // flush() marker: set once everything queued before it is written
+        std::atomic<bool>* flushed = nullptr;
+    };
+
+    struct Writer {
+        MpscQueue<Record> queue;
+        std::atomic<bool> wake{false};
+        std::atomic<bool> stop{false};
+        // held by the writer thread while it writes, and by set_file
+        std::mutex file_mutex;
+        std::ofstream file;
+        std::thread thread;
+
+        Writer() : thread([this] { run(); }) {}
+
+        ~Writer() {
+            stop.store(true);
+            notify();
+            thread.join();
+            shut_down.store(true);
+        }
+
+        void notify() {
+            // only the first record after the writer went to sleep pays for the wake-up
+            if (!wake.exchange(true))
+                wake.notify_one();
+        }
+
+        void run() {
+            std::string console;
+            std::string plain;
+            for (;;) {
+                wake.wait(false);
+                wake.store(false);
+                bool stopping = stop.load();
+
+                while (auto record = queue.pop()) {
+                    if (record->flushed) {
+                        write(console, plain);
+                        record->flushed->store(true);
+                        record->flushed->notify_all();
+                        continue;
+                    }
+                    append_line(*record, console, plain);
+                }
+                write(console, plain);
+
+                if (stopping)
+                    return;
+            }
+        }
+
+        void write(std::string& console, std::string& plain) {
+            if (console.empty())
+                return;
+            std::cout.write(console.data(), console.size());
+            std::cout.flush();
+
+            std::lock_guard<std::mutex> lock(file_mutex);
+            if (file.is_open()) {
+                file.write(plain.data(), plain.size());
+                file.flush();
+            }
+            console.clear();
+            plain.clear();
+        }
+    };
+
+    // set once the writer is gone (static destruction); later calls write synchronously
+    inline static std::atomic<bool> shut_down{false};
+
+    static Writer& writer() {
+        static Writer instance;
+        return instance;
+    }
+
+    static std::string timestamp(std::chrono::system_clock::time_point now) {
+        using namespace std::chrono;
+
+        auto local_time = current_zone()->to_local(now);
+        auto dp = floor<days>(local_time);
+        auto time = local_time - dp;
+
+        auto h = duration_cast<hours>(time);
+        auto m = duration_cast<minutes>(time - h);
+        auto s = duration_cast<seconds>(time - h - m);
+        auto ms = duration_cast<milliseconds>(time - h - m - s);
+
+        return std::format("{:02}:{:02}:{:02}.{:03}", h.count(), m.count(), s.count(), ms.count());
+    }
+
+    static void append_line(const Record& record, std::string& console, std::string& plain) {
+        static constexpr const char* colors[] = {COLOR_DEBUG, COLOR_INFO, COLOR_SUCCESS,
+                                                 COLOR_WARN, COLOR_ERR};
+        static constexpr const char* names[] = {"DEBUG", "INFO", "SUCCESS", "WARN", "ERR"};
+        auto level = static_cast<size_t>(record.level);
+
+        std::string message = record.format ? record.format(record.format_string, record.args)
+                                             : std::string();
+        const std::string& text = record.format ? message : record.message;
+        std::string line = std::format("{} [{}] {}", timestamp(record.time), names[level], text);
+
+        console += colors[level];
+        console += line;
+        console += COLOR_RESET "\n";
+        plain += line;
+        plain += '\n';
+    }
+
+    static ArgPack<> pack() { return {}; }
+
+    template <typename T, typename... Rest>
+    static ArgPack<T, Rest...> pack(const T& first, const Rest&... rest) {
+        return {first, pack(rest...)};
+    }
+
+    template <typename F> static std::string apply(const ArgPack<>&, F&& f) { return f(); }
+
+    template <typename T, typename... Rest, typename F>
+    static std::string apply(const ArgPack<T, Rest...>& args, F&& f) {
+        return apply(args.rest, [&](const auto&... rest) { return f(args.first, rest...); });
+    }
+
+    template <typename... Ts>
+    static std::string format_deferred(std::string_view format, const std::byte* bytes) {
+        ArgPack<Ts...> args;
+        std::memcpy(&args, bytes, sizeof(args));
+        return apply(args, [&](const auto&... values) {
+            return std::vformat(format, std::make_format_args(values...));
+        });
+    }
+
+    static void enqueue(Record record) {
+        if (shut_down.load()) {
+            std::string console, plain;
+            append_line(record, console, plain);
+            std::cout << console << std::flush;
+            return;
+        }
+        Writer& w = writer();
+        w.queue.push(std::move(record));
+        w.notify();
+    }
+
+    template <typename... Args>
+    static void log(Level level, std::format_string<Args...> fmt, Args&&... args) {
+        Record record;
+        record.level = level;
+        record.time = std::chrono::system_clock::now();
+
+        using Pack = ArgPack<std::remove_cvref_t<Args>...>;
+        if constexpr ((deferrable<std::remove_cvref_t<Args>> && ...) &&
+                      sizeof(Pack) <= DEFERRED_ARGS_SIZE) {
+            Pack values = pack(static_cast<std::remove_cvref_t<Args>>(args)...);
+            std::memcpy(record.args, &values, sizeof(Pack));
+            record.format = &format_deferred<std::remove_cvref_t<Args>...>;
+            record.format_string = fmt.get();
+        } else {
+            record.message = std::format(fmt, std::forward<Args>(args)...);
+        }
+        enqueue(std::move(record));
+    }
+
+  public:
+    template <typename... Args>
+    static void debug(std::format_string<Args...> fmt, Args&&... args) {
+        log(Level::Debug, fmt, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args> static void info(std::format_string<Args...> fmt, Args&&... args) {
+        log(Level::Info, fmt, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    static void success(std::format_string<Args...> fmt, Args&&... args) {
+        log(Level::Success, fmt, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args> static void warn(std::format_string<Args...> fmt, Args&&... args) {
+        log(Level::Warn, fmt, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args> static void err(std::format_string<Args...> fmt, Args&&... args) {
+        log(Level::Err, fmt, std::forward<Args>(args)...);
+    }
+
+    // Also write every line from now on to path (without colors), truncating it.
+    static bool set_file(const std::string& path) {
+        Writer& w = writer();
+        std::lock_guard<std::mutex> lock(w.file_mutex);
+        w.file.close();
+        w.file.open(path, std::ios::trunc);
+        return w.file.is_open();
+    }
+
+    // Blocks until everything logged before the call has been written.
+    static void flush() {
+        if (shut_down.load())
+            return;
+        std::atomic<bool> flushed{false};
+        Record marker;
+        marker.flushed = &flushed;
+        enqueue(std::move(marker));
+        flushed.wait(false);
+    }
 };
 
+#ifdef _WIN32
 struct EnableAnsi {
-  EnableAnsi() {
-    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
-    if (hOut != INVALID_HANDLE_VALUE) {
-      DWORD dwMode = 0;
-      if (GetConsoleMode(hOut, &dwMode)) {
-        dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
-        SetConsoleMode(hOut, dwMode);
-      }
-    }
-  }
+    EnableAnsi() {
+        HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+        if (hOut != INVALID_HANDLE_VALUE) {
+            DWORD dwMode = 0;
+            if (GetConsoleMode(hOut, &dwMode)) {
+                dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+                SetConsoleMode(hOut, dwMode);
+            }
+        }
+    }
 };
 inline static EnableAnsi enable_ansi;
+#endif
 
-#define LOG_DEBUG(...) Logger::debug(__VA_ARGS__)
-#define LOG_INFO(...) Logger::info(__VA_ARGS__)
-#define LOG_SUCCESS(...) Logger::success(__VA_ARGS__)
-#define LOG_WARN(...) Logger::warn(__VA_ARGS__)
-#define LOG_ERR(...) Logger::err(__VA_ARGS__)
\ No newline at end of file
+#if LOG_MIN_LEVEL <= LOG_LEVEL_DEBUG
+    #define LOG_DEBUG(...) Logger::debug(__VA_ARGS__)
+#else
+    #define LOG_DEBUG(...) ((void)0)
+#endif
+#if LOG_MIN_LEVEL <= LOG_LEVEL_INFO
+    #define LOG_INFO(...) Logger::info(__VA_ARGS__)
+#else
+    #define LOG_INFO(...) ((void)0)
+#endif
+#if LOG_MIN_LEVEL <= LOG_LEVEL_SUCCESS
+    #define LOG_SUCCESS(...) Logger::success(__VA_ARGS__)
+#else
+    #define LOG_SUCCESS(...) ((void)0)
+#endif
+#if LOG_MIN_LEVEL <= LOG_LEVEL_WARN
+    #define LOG_WARN(...) Logger::warn(__VA_ARGS__)
+#else
+    #define LOG_WARN(...) ((void)0)
+#endif
+#define LOG_ERR(...) Logger::err(__VA_ARGS__)
@@ -0,0 +1,58 @@
+#pragma once
+#include <atomic>
+#include <optional>
+#include <utility>
+
+// Unbounded multi-producer single-consumer queue (Vyukov's intrusive design). push() is wait-free
+// and can be called from any thread; pop() and empty() must only be called by one thread at a
+// time, callers with several consumers serialize them themselves.
+template <typename T> class MpscQueue {
+  private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        std::optional<T> value;
+    };
+
+    // producers swing head; the consumer owns tail, which always points at a consumed stub node
+    std::atomic<Node*> head;
+    Node* tail;
+
+  public:
+    MpscQueue() {
+        Node* stub = new Node();
+        head.store(stub, std::memory_order_relaxed);
+        tail = stub;
+    }
+
+    ~MpscQueue() {
+        while (pop()) {
+        }
+        delete tail;
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    void push(T value) {
+        Node* node = new Node();
+        node->value.emplace(std::move(value));
+        Node* prev = head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // nullopt when the queue is empty, or when a producer is halfway through push(); that
+    // element shows up on the next call
+    std::optional<T> pop() {
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (!next)
+            return std::nullopt;
+
+        std::optional<T> value = std::move(next->value);
+        next->value.reset();
+        delete tail;
+        tail = next;
+        return value;
+    }
+
+    bool empty() const { return tail->next.load(std::memory_order_acquire) == nullptr; }
+};
@@ -0,0 +1,324 @@
+#pragma once
+#include "utils/logger.hpp"
+#include "utils/offset_file.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+// What changed between two dumps: offsets that moved, appeared or disappeared, grouped by
+// namespace. Each namespace's offsets are already sorted by name, so a diff is one merge walk per
+// namespace. Moved offsets are also grouped into shifts: runs of neighbouring fields (in old
+// offset order) that all moved by the same amount, which is what a field inserted into or removed
+// from a class looks like.
+namespace offset_diff {
+
+    // a lone moved field is reported as a move, not a shift
+    inline constexpr size_t MIN_SHIFT_RUN = 2;
+
+    struct Move {
+        std::string name;
+        uintptr_t old_value = 0;
+        uintptr_t new_value = 0;
+        int64_t delta() const { return int64_t(new_value) - int64_t(old_value); }
+    };
+
+    struct Value {
+        std::string name;
+        uintptr_t value = 0;
+    };
+
+    // fields from first to last (old offsets, inclusive) all moved by delta
+    struct Shift {
+        uintptr_t first = 0;
+        uintptr_t last = 0;
+        int64_t delta = 0;
+        size_t count = 0;
+    };
+
+    struct NamespaceDiff {
+        std::string ns;
+        std::vector<Move> moved;
+        std::vector<Value> added;
+        std::vector<Value> removed;
+        std::vector<Shift> shifts;
+        size_t unchanged = 0;
+
+        bool empty() const { return moved.empty() && added.empty() && removed.empty(); }
+    };
+
+    struct Diff {
+        std::string old_label;
+        std::string new_label;
+        // only namespaces with changes
+        std::vector<NamespaceDiff> namespaces;
+        size_t moved = 0;
+        size_t added = 0;
+        size_t removed = 0;
+        size_t unchanged = 0;
+    };
+
+    // A dump plus what to call it in the output.
+    struct Source {
+        std::string label;
+        offset_file::Dump dump;
+    };
+
+    // runs of equal deltas in moves, which are neighbouring fields in old offset order
+    inline std::vector<Shift> find_shifts(const std::vector<Move>& moves) {
+        std::vector<Shift> shifts;
+        size_t start = 0;
+        for (size_t i = 1; i <= moves.size(); i++) {
+            if (i < moves.size() && moves[i].delta() == moves[start].delta())
+                continue;
+            if (i - start >= MIN_SHIFT_RUN) {
+                shifts.push_back({moves[start].old_value, moves[i - 1].old_value,
+                                  moves[start].delta(), i - start});
+            }
+            start = i;
+        }
+        return shifts;
+    }
+
+    inline NamespaceDiff diff_namespace(const std::string& ns,
+                                        const std::map<std::string, uintptr_t>* old_offsets,
+                                        const std::map<std::string, uintptr_t>* new_offsets) {
+        static const std::map<std::string, uintptr_t> none;
+        const auto& before = old_offsets ? *old_offsets : none;
+        const auto& after = new_offsets ? *new_offsets : none;
+
+        NamespaceDiff result;
+        result.ns = ns;
+
+        // every field in old offset order, unchanged ones included, so a run of equal deltas is
+        // only a shift if no field that stayed put sits inside it
+        struct Field {
+            uintptr_t old_value;
+            std::optional<size_t> move;
+        };
+        std::vector<Field> fields;
+
+        auto old_it = before.begin();
+        auto new_it = after.begin();
+        while (old_it != before.end() || new_it != after.end()) {
+            bool old_first = new_it == after.end() ||
+                             (old_it != before.end() && old_it->first < new_it->first);
+            if (old_first) {
+                result.removed.push_back({old_it->first, old_it->second});
+                ++old_it;
+            } else if (old_it == before.end() || new_it->first < old_it->first) {
+                result.added.push_back({new_it->first, new_it->second});
+                ++new_it;
+            } else {
+                if (old_it->second != new_it->second) {
+                    fields.push_back({old_it->second, result.moved.size()});
+                    result.moved.push_back({old_it->first, old_it->second, new_it->second});
+                } else {
+                    fields.push_back({old_it->second, std::nullopt});
+                    result.unchanged++;
+                }
+                ++old_it;
+                ++new_it;
+            }
+        }
+
+        if (result.moved.size() < MIN_SHIFT_RUN)
+            return result;
+
+        std::stable_sort(fields.begin(), fields.end(), [](const Field& a, const Field& b) {
+            return a.old_value < b.old_value;
+        });
+
+        std::vector<Move> run;
+        auto flush = [&] {
+            auto shifts = find_shifts(run);
+            result.shifts.insert(result.shifts.end(), shifts.begin(), shifts.end());
+            run.clear();
+        };
+        for (const auto& field : fields) {
+            if (field.move)
+                run.push_back(result.moved[*field.move]);
+            else
+                flush();
+        }
+        flush();
+        return result;
+    }
+
+    inline Diff diff(const Source& before, const Source& after) {
+        Diff result;
+        result.old_label = before.label;
+        result.new_label = after.label;
+
+        auto offsets_of = [](const offset_file::Dump& dump, const std::string& ns) {
+            auto it = dump.namespaces.find(ns);
+            return it == dump.namespaces.end() ? nullptr : &it->second;
+        };
+
+        // the new dump's namespace order, then namespaces that are gone
+        std::vector<std::string> order = after.dump.namespace_order;
+        for (const auto& ns : before.dump.namespace_order) {
+            if (!after.dump.namespaces.count(ns))
+                order.push_back(ns);
+        }
+
+        for (const auto& ns : order) {
+            auto ns_diff =
+                diff_namespace(ns, offsets_of(before.dump, ns), offsets_of(after.dump, ns));
+            result.moved += ns_diff.moved.size();
+            result.added += ns_diff.added.size();
+            result.removed += ns_diff.removed.size();
+            result.unchanged += ns_diff.unchanged;
+            if (!ns_diff.empty())
+                result.namespaces.push_back(std::move(ns_diff));
+        }
+        return result;
+    }
+
+    inline nlohmann::ordered_json to_json(const Diff& diff) {
+        nlohmann::ordered_json namespaces = nlohmann::ordered_json::object();
+        for (const auto& ns : diff.namespaces) {
+            nlohmann::ordered_json entry = nlohmann::ordered_json::object();
+            if (!ns.moved.empty()) {
+                auto& moved = entry["moved"] = nlohmann::ordered_json::object();
+                for (const auto& move : ns.moved) {
+                    moved[move.name] = {
+                        {"old", move.old_value}, {"new", move.new_value}, {"delta", move.delta()}};
+                }
+            }
+            if (!ns.added.empty()) {
+                auto& added = entry["added"] = nlohmann::ordered_json::object();
+                for (const auto& value : ns.added)
+                    added[value.name] = value.value;
+            }
+            if (!ns.removed.empty()) {
+                auto& removed = entry["removed"] = nlohmann::ordered_json::object();
+                for (const auto& value : ns.removed)
+                    removed[value.name] = value.value;
+            }
+            if (!ns.shifts.empty()) {
+                auto& shifts = entry["shifts"] = nlohmann::ordered_json::array();
+                for (const auto& shift : ns.shifts) {
+                    shifts.push_back({{"first", shift.first},
+                                      {"last", shift.last},
+                                      {"delta", shift.delta},
+                                      {"count", shift.count}});
+                }
+            }
+            namespaces[ns.ns] = std::move(entry);
+        }
+
+        return {
+            {"old", diff.old_label},
+            {"new", diff.new_label},
+            {"summary",
+             {{"moved", diff.moved},
+              {"added", diff.added},
+              {"removed", diff.removed},
+              {"unchanged", diff.unchanged}}},
+            {"namespaces", std::move(namespaces)},
+        };
+    }
+
+    inline std::string signed_hex(int64_t value) {
+        return value < 0 ? std::format("-0x{:X}", uint64_t(-value)) : std::format("+0x{:X}", value);
+    }
+
+    inline void log_summary(const Diff& diff) {
+        LOG_INFO("{} -> {}: {} moved, {} added, {} removed, {} unchanged", diff.old_label,
+                 diff.new_label, diff.moved, diff.added, diff.removed, diff.unchanged);
+
+        for (const auto& ns : diff.namespaces) {
+            std::string line = std::format("  {}:", ns.ns);
+            if (!ns.moved.empty())
+                line += std::format(" {} moved", ns.moved.size());
+            if (!ns.added.empty())
+                line += std::format(" {} added", ns.added.size());
+            if (!ns.removed.empty())
+                line += std::format(" {} removed", ns.removed.size());
+            LOG_INFO("{}", line);
+
+            for (const auto& shift : ns.shifts) {
+                LOG_INFO("    0x{:X}..0x{:X} shifted {} ({} offsets)", shift.first, shift.last,
+                         signed_hex(shift.delta), shift.count);
+            }
+        }
+    }
+
+    // Files are loaded in the order given; a directory contributes every .json in it, oldest
+    // first by the dump's own timestamp.
+    inline std::optional<std::vector<Source>> load_all(const std::vector<std::string>& paths) {
+        std::vector<Source> sources;
+
+        for (const auto& path : paths) {
+            std::error_code ec;
+            if (!std::filesystem::is_directory(path, ec)) {
+                auto dump = offset_file::load(path);
+                if (!dump)
+                    return std::nullopt;
+                sources.push_back({path, std::move(*dump)});
+                continue;
+            }
+
+            std::vector<Source> directory;
+            for (const auto& file : std::filesystem::directory_iterator(path, ec)) {
+                if (file.path().extension() != ".json")
+                    continue;
+                // other JSON next to the dumps (offsets_diff.json, say) is skipped, not fatal
+                auto dump = offset_file::load(file.path().string());
+                if (!dump)
+                    continue;
+                directory.push_back({file.path().string(), std::move(*dump)});
+            }
+            if (ec) {
+                LOG_ERR("Failed to list {}: {}", path, ec.message());
+                return std::nullopt;
+            }
+
+            std::sort(directory.begin(), directory.end(), [](const Source& a, const Source& b) {
+                if (a.dump.timestamp != b.dump.timestamp)
+                    return a.dump.timestamp < b.dump.timestamp;
+                return a.label < b.label;
+            });
+            for (auto& source : directory)
+                sources.push_back(std::move(source));
+        }
+        return sources;
+    }
+
+    // Diffs each source against the next, logs a summary of each pair and writes them all to
+    // output_path as {"diffs": [...]}.
+    inline bool run(const std::vector<Source>& sources, const std::string& output_path) {
+        if (sources.size() < 2) {
+            LOG_ERR("Diffing needs at least two dumps, got {}", sources.size());
+            return false;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        nlohmann::ordered_json diffs = nlohmann::ordered_json::array();
+        for (size_t i = 1; i < sources.size(); i++) {
+            Diff diff = offset_diff::diff(sources[i - 1], sources[i]);
+            log_summary(diff);
+            diffs.push_back(to_json(diff));
+        }
+
+        nlohmann::ordered_json document = {{"diffs", std::move(diffs)}};
+        if (!offset_file::write_atomic(output_path, document.dump(4) + "\n"))
+            return false;
+
+        auto elapsed = std::chrono::duration<double, std::milli>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+        LOG_SUCCESS("Diffed {} dumps in {:.1f}ms, saved to: {}", sources.size(), elapsed,
+                    output_path);
+        return true;
+    }
+
+} // namespace offset_diff
@@ -0,0 +1,122 @@
+#pragma once
+#include "utils/logger.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Reader for the offsets.json that OffsetRegistry::write_to_file emits, plus the pieces of it
+// that the dump cache and phase checkpoints reuse.
+namespace offset_file {
+
+    struct Dump {
+        std::string roblox_version;
+        // metadata.timestamp of a loaded offsets.json, empty otherwise
+        std::string timestamp;
+        std::vector<std::string> namespace_order;
+        std::map<std::string, std::map<std::string, uintptr_t>> namespaces;
+
+        std::optional<uintptr_t> find(const std::string& ns, const std::string& name) const {
+            auto it = namespaces.find(ns);
+            if (it == namespaces.end())
+                return std::nullopt;
+            auto off = it->second.find(name);
+            if (off == it->second.end())
+                return std::nullopt;
+            return off->second;
+        }
+
+        size_t total_offsets() const {
+            size_t total = 0;
+            for (const auto& [ns, offsets] : namespaces)
+                total += offsets.size();
+            return total;
+        }
+    };
+
+    // The "offsets" object shared by offsets.json, the dump cache and phase checkpoints.
+    inline nlohmann::ordered_json offsets_to_json(const Dump& dump) {
+        nlohmann::ordered_json offsets = nlohmann::ordered_json::object();
+        for (const auto& ns : dump.namespace_order) {
+            auto it = dump.namespaces.find(ns);
+            if (it == dump.namespaces.end())
+                continue;
+            for (const auto& [name, value] : it->second)
+                offsets[ns][name] = value;
+        }
+        return offsets;
+    }
+
+    // Offsets are numbers here, but the published offsets.json writes them as "0x1C0" strings;
+    // both are accepted. Throws on anything else, like nlohmann's get.
+    inline void offsets_from_json(const nlohmann::ordered_json& offsets, Dump& dump) {
+        for (const auto& [ns, entries] : offsets.items()) {
+            dump.namespace_order.push_back(ns);
+            auto& target = dump.namespaces[ns];
+            for (const auto& [name, value] : entries.items()) {
+                if (value.is_string())
+                    target[name] = std::stoull(value.get<std::string>(), nullptr, 16);
+                else
+                    target[name] = value.get<uintptr_t>();
+            }
+        }
+    }
+
+    // Writes next to the target and renames over it, so a crash never leaves half a file.
+    inline bool write_atomic(const std::string& path, const std::string& contents) {
+        std::error_code ec;
+        auto parent = std::filesystem::path(path).parent_path();
+        if (!parent.empty())
+            std::filesystem::create_directories(parent, ec);
+
+        std::string temp_path = path + ".tmp";
+        {
+            std::ofstream file(temp_path, std::ios::trunc | std::ios::binary);
+            if (!file.is_open()) {
+                LOG_ERR("Failed to create file: {}", temp_path);
+                return false;
+            }
+            file << contents;
+            if (!file.good()) {
+                LOG_ERR("Failed to write file: {}", temp_path);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temp_path, path, ec);
+        if (ec) {
+            LOG_ERR("Failed to move {} into place: {}", path, ec.message());
+            return false;
+        }
+        return true;
+    }
+
+    inline std::optional<Dump> load(const std::string& path) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            LOG_ERR("Failed to open offsets file: {}", path);
+            return std::nullopt;
+        }
+
+        try {
+            auto j = nlohmann::ordered_json::parse(file);
+
+            Dump dump;
+            if (j.contains("metadata")) {
+                dump.roblox_version = j["metadata"].value("roblox_version", "");
+                dump.timestamp = j["metadata"].value("timestamp", "");
+            }
+
+            offsets_from_json(j.at("offsets"), dump);
+            return dump;
+        } catch (const std::exception& e) {
+            LOG_ERR("Failed to parse offsets file {}: {}", path, e.what());
+            return std::nullopt;
+        }
+    }
+
+} // namespace offset_file
@@ -1,24 +1,171 @@
 #pragma once
 #include "sdk/offsets.hpp"
 #include "utils/logger.hpp"
+#include "utils/offset_file.hpp"
+#include "utils/offset_writer.hpp"
+#include "utils/string_interner.hpp"
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <ctime>
-#include <fstream>
 #include <iomanip>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <regex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+// Safe for concurrent add/get/seed from parallel phases. Namespace and offset names are interned
+// to integer ids, and offsets live in shards keyed by the (namespace, name) id pair, each with its
+// own reader/writer lock, so phases writing different offsets rarely touch the same lock.
+// Callers on a hot path can resolve a Key once and skip the string lookups entirely.
 class OffsetRegistry {
+  public:
+    struct Key {
+        StringInterner::Id ns;
+        StringInterner::Id name;
+
+        uint64_t packed() const { return (uint64_t(ns) << 32) | name; }
+    };
+
+    // Namespaces are written out in the order they first received an offset. Phases run inside a
+    // PhaseScope, which makes that order follow the phase list (then the order of adds within the
+    // phase) instead of whichever thread got there first.
+    class PhaseScope {
+      public:
+        explicit PhaseScope(uint32_t phase_index)
+            : previous_phase(current_phase), previous_sequence(next_sequence) {
+            current_phase = phase_index + 1;
+            next_sequence = 0;
+        }
+        ~PhaseScope() {
+            current_phase = previous_phase;
+            next_sequence = previous_sequence;
+        }
+
+        PhaseScope(const PhaseScope&) = delete;
+        PhaseScope& operator=(const PhaseScope&) = delete;
+
+      private:
+        uint32_t previous_phase;
+        uint32_t previous_sequence;
+    };
+
   private:
-    std::map<std::string, std::map<std::string, uintptr_t>> namespaces;
-    std::vector<std::string> namespace_order;
+    // offsets within this distance of their seeded value count as shifted, not rediscovered
+    static constexpr uintptr_t SEED_SHIFT_WINDOW = 0x40;
+    static constexpr size_t SHARD_BITS = 4;
+
+    enum class SeedOutcome { Reused, Shifted, Rediscovered, New };
+
+    struct SeedEntry {
+        SeedOutcome outcome;
+        uintptr_t previous;
+        uintptr_t current;
+    };
+
+    struct Entry {
+        Key key;
+        uintptr_t value;
+        // lowest (phase << 32 | add within phase) this offset was added at
+        uint64_t order;
+        std::optional<SeedEntry> seed{};
+    };
+
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<uint64_t, Entry> entries;
+    };
+
+    // outside any PhaseScope (restore, tooling) current_phase is 0, which sorts first
+    static inline thread_local uint32_t current_phase = 0;
+    static inline thread_local uint32_t next_sequence = 0;
+
+    StringInterner names;
+    std::array<Shard, size_t(1) << SHARD_BITS> shards;
+
+    // sdk::offsets variables by Key, built from sdk::offsets::BINDINGS; read-only after
+    // construction
+    std::unordered_map<uint64_t, std::atomic<uintptr_t>*> bindings;
+
     std::chrono::time_point<std::chrono::high_resolution_clock> start_time;
     std::string roblox_version;
 
-    OffsetRegistry() { start_time = std::chrono::high_resolution_clock::now(); }
+    // written by load_seed before the phases start, read-only afterwards
+    std::unordered_map<uint64_t, uintptr_t> seed_offsets;
+    std::string seed_version;
+
+    OffsetRegistry() {
+        start_time = std::chrono::high_resolution_clock::now();
+
+        for (const auto& binding : sdk::offsets::BINDINGS) {
+            Key key{names.intern(binding.ns), names.intern(binding.name)};
+            bindings.emplace(key.packed(), binding.target);
+        }
+    }
+
+    static size_t shard_index(Key key) {
+        // Fibonacci hashing: the top bits of the product mix both ids
+        return (key.packed() * 0x9E3779B97F4A7C15ull) >> (64 - SHARD_BITS);
+    }
+    Shard& shard_for(Key key) { return shards[shard_index(key)]; }
+    const Shard& shard_for(Key key) const { return shards[shard_index(key)]; }
+
+    std::optional<Key> find_key(const std::string& namespace_name,
+                                const std::string& offset_name) const {
+        auto ns = names.find(namespace_name);
+        auto name = names.find(offset_name);
+        if (!ns || !name)
+            return std::nullopt;
+        return Key{*ns, *name};
+    }
+
+    std::optional<SeedEntry> seed_outcome(Key key, uintptr_t value) const {
+        if (seed_offsets.empty())
+            return std::nullopt;
+
+        SeedEntry entry{SeedOutcome::New, 0, value};
+        auto previous = seed_offsets.find(key.packed());
+        if (previous != seed_offsets.end()) {
+            entry.previous = previous->second;
+            uintptr_t distance = value > entry.previous ? value - entry.previous
+                                                        : entry.previous - value;
+            if (distance == 0)
+                entry.outcome = SeedOutcome::Reused;
+            else if (distance <= SEED_SHIFT_WINDOW)
+                entry.outcome = SeedOutcome::Shifted;
+            else
+                entry.outcome = SeedOutcome::Rediscovered;
+        }
+        return entry;
+    }
+
+    std::vector<Entry> snapshot() const {
+        std::vector<Entry> entries;
+        for (const auto& shard : shards) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            for (const auto& [packed, entry] : shard.entries)
+                entries.push_back(entry);
+        }
+        return entries;
+    }
+
+    // seeds by namespace and name, sorted, for reporting
+    std::map<std::string, std::map<std::string, uintptr_t>> named_seeds() const {
+        std::map<std::string, std::map<std::string, uintptr_t>> result;
+        for (const auto& [packed, value] : seed_offsets) {
+            result[names.name(StringInterner::Id(packed >> 32))]
+                  [names.name(StringInterner::Id(packed))] = value;
+        }
+        return result;
+    }
 
   public:
     static OffsetRegistry& instance() {
@@ -26,161 +173,207 @@ class OffsetRegistry {
         return registry;
     }
 
-    void add(const std::string& namespace_name, const std::string& offset_name, uintptr_t value) {
-        auto it = std::find(namespace_order.begin(), namespace_order.end(), namespace_name);
-        if (it == namespace_order.end()) {
-            namespace_order.push_back(namespace_name);
-        }
-        namespaces[namespace_name][offset_name] = value;
-
-        if (namespace_name == "Instance") {
-            if (offset_name == "ClassDescriptor")
-                sdk::offsets::Instance::ClassDescriptor = value;
-            else if (offset_name == "Parent")
-                sdk::offsets::Instance::Parent = value;
-            else if (offset_name == "Name")
-                sdk::offsets::Instance::Name = value;
-            else if (offset_name == "ClassName")
-                sdk::offsets::Instance::ClassName = value;
-            else if (offset_name == "ChildrenStart")
-                sdk::offsets::Instance::ChildrenStart = value;
-            else if (offset_name == "ChildrenEnd")
-                sdk::offsets::Instance::ChildrenEnd = value;
+    Key key(const std::string& namespace_name, const std::string& offset_name) {
+        return {names.intern(namespace_name), names.intern(offset_name)};
+    }
+
+    void add(Key key, uintptr_t value) {
+        uint64_t order = (uint64_t(current_phase) << 32) | next_sequence++;
+        auto seed = seed_outcome(key, value);
+
+        {
+            Shard& shard = shard_for(key);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            auto [it, inserted] = shard.entries.try_emplace(key.packed(), Entry{key, value, order});
+            it->second.value = value;
+            it->second.order = (std::min)(it->second.order, order);
+            it->second.seed = seed;
         }
-        LOG_SUCCESS("{}: 0x{:X}", offset_name, value);
+
+        auto binding = bindings.find(key.packed());
+        if (binding != bindings.end())
+            binding->second->store(value, std::memory_order_release);
+
+        LOG_SUCCESS("{}: 0x{:X}", names.name(key.name), value);
     }
 
-    uintptr_t get(const std::string& namespace_name, const std::string& offset_name) const {
-        auto it = namespaces.find(namespace_name);
-        if (it == namespaces.end())
-            return 0;
+    void add(const std::string& namespace_name, const std::string& offset_name, uintptr_t value) {
+        add(key(namespace_name, offset_name), value);
+    }
 
-        auto off = it->second.find(offset_name);
-        if (off == it->second.end())
-            return 0;
+    uintptr_t get(Key key) const {
+        const Shard& shard = shard_for(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.entries.find(key.packed());
+        return it == shard.entries.end() ? 0 : it->second.value;
+    }
 
-        return off->second;
+    uintptr_t get(const std::string& namespace_name, const std::string& offset_name) const {
+        auto key = find_key(namespace_name, offset_name);
+        return key ? get(*key) : 0;
     }
 
     void set_roblox_version(const std::string& version) { roblox_version = version; }
+    const std::string& get_roblox_version() const { return roblox_version; }
 
-    void write_to_file(const std::string& filename = "offsets.hpp") {
-        auto end_time = std::chrono::high_resolution_clock::now();
-        double duration = std::chrono::duration<double>(end_time - start_time).count();
+    offset_file::Dump to_dump() const {
+        offset_file::Dump dump;
+        dump.roblox_version = roblox_version;
 
-        auto fflags_it = std::find(namespace_order.begin(), namespace_order.end(), "FFlags");
-        if (fflags_it != namespace_order.end()) {
-            namespace_order.erase(fflags_it);
-            namespace_order.push_back("FFlags");
+        // a namespace sorts by the earliest add of any of its offsets
+        std::unordered_map<StringInterner::Id, uint64_t> first_order;
+        for (const auto& entry : snapshot()) {
+            dump.namespaces[names.name(entry.key.ns)][names.name(entry.key.name)] = entry.value;
+            auto [it, inserted] = first_order.try_emplace(entry.key.ns, entry.order);
+            it->second = (std::min)(it->second, entry.order);
         }
 
-        auto now = std::chrono::system_clock::now();
-        auto time_t_val = std::chrono::system_clock::to_time_t(now);
-        std::stringstream timestamp;
-        timestamp << std::put_time(std::localtime(&time_t_val), "%Y-%m-%d %H:%M:%S");
+        std::vector<std::pair<uint64_t, StringInterner::Id>> order;
+        for (const auto& [ns, first] : first_order)
+            order.push_back({first, ns});
+        std::sort(order.begin(), order.end());
+        for (const auto& [first, ns] : order)
+            dump.namespace_order.push_back(names.name(ns));
+        return dump;
+    }
 
-        size_t total_offsets = 0;
-        for (const auto& [ns, offsets] : namespaces)
-            total_offsets += offsets.size();
+    // Takes over a complete set of offsets, e.g. from the dump cache, as if the phases had
+    // added them one by one.
+    void restore(const offset_file::Dump& dump) {
+        for (const auto& ns : dump.namespace_order) {
+            auto it = dump.namespaces.find(ns);
+            if (it == dump.namespaces.end())
+                continue;
+            for (const auto& [name, value] : it->second)
+                add(ns, name, value);
+        }
+    }
 
-        std::ofstream file(filename);
-        if (!file.is_open()) {
-            LOG_ERR("Failed to create file: {}", filename);
-            return;
+    // Offsets from a previous dump. Phases pass seed(...) as the hint to the find_* primitives,
+    // so offsets that did not move are confirmed with a single read instead of a full search.
+    // Has to happen before the phases start.
+    void load_seed(const offset_file::Dump& dump) {
+        for (const auto& [ns, offsets] : dump.namespaces) {
+            for (const auto& [name, value] : offsets)
+                seed_offsets[key(ns, name).packed()] = value;
         }
+        seed_version = dump.roblox_version;
+        LOG_INFO("Seeded {} offsets from previous dump{}", dump.total_offsets(),
+                 seed_version.empty() ? "" : " (" + seed_version + ")");
+    }
+
+    std::optional<size_t> seed(const std::string& namespace_name, const std::string& offset_name,
+                               ptrdiff_t delta = 0) const {
+        auto key = find_key(namespace_name, offset_name);
+        if (!key)
+            return std::nullopt;
+
+        auto it = seed_offsets.find(key->packed());
+        if (it == seed_offsets.end())
+            return std::nullopt;
 
-        file << "//================================================================\n";
-        file << "// Dumped By Jonah's Roblox Dumper | Discord: jonahw\n";
-        file << "// Github Link: https://github.com/nopjo/roblox-dumper\n";
-        file << "// Contributors: @4hd8, @fulore \n";
-        file << "// Dumped at: " << timestamp.str() << "\n";
-        if (!roblox_version.empty()) {
-            file << "// Roblox Version: " << roblox_version << "\n";
+        return it->second + delta;
+    }
+
+    void log_seed_report() const {
+        if (seed_offsets.empty())
+            return;
+
+        size_t counts[4] = {};
+        std::map<std::string, std::map<std::string, SeedEntry>> seed_results;
+        std::unordered_set<uint64_t> found;
+        for (const auto& entry : snapshot()) {
+            found.insert(entry.key.packed());
+            if (!entry.seed)
+                continue;
+            counts[static_cast<int>(entry.seed->outcome)]++;
+            seed_results[names.name(entry.key.ns)][names.name(entry.key.name)] = *entry.seed;
         }
-        file << "// Total offsets dumped: " << total_offsets << "\n";
-        file << "//================================================================\n\n";
-        file << "#pragma once\n";
-        file << "#include <cstdint>\n\n";
-        file << "namespace offsets {\n";
-
-        for (size_t i = 0; i < namespace_order.size(); i++) {
-            const auto& namespace_name = namespace_order[i];
-            auto ns_it = namespaces.find(namespace_name);
-            if (ns_it != namespaces.end()) {
-                file << "    namespace " << namespace_name << " {\n";
-                for (const auto& [offset_name, offset_value] : ns_it->second) {
-                    file << "        inline constexpr uintptr_t " << offset_name << " = 0x"
-                         << std::hex << std::uppercase << offset_value << ";\n";
-                }
-                file << "    }";
 
-                if (i < namespace_order.size() - 1) {
-                    file << "\n\n";
-                } else {
-                    file << "\n";
+        size_t missing = 0;
+        for (const auto& [packed, value] : seed_offsets)
+            if (!found.count(packed))
+                missing++;
+
+        LOG_INFO("Seed report: {} reused, {} shifted, {} rediscovered, {} new, {} missing",
+                 counts[0], counts[1], counts[2], counts[3], missing);
+
+        for (const auto& [ns, entries] : seed_results) {
+            std::string reused;
+            for (const auto& [name, entry] : entries) {
+                switch (entry.outcome) {
+                    case SeedOutcome::Reused:
+                        reused += (reused.empty() ? "" : ", ") + name;
+                        break;
+                    case SeedOutcome::Shifted:
+                        LOG_INFO("  shifted      {}::{} 0x{:X} -> 0x{:X} ({}0x{:X})", ns, name,
+                                 entry.previous, entry.current,
+                                 entry.current > entry.previous ? "+" : "-",
+                                 entry.current > entry.previous ? entry.current - entry.previous
+                                                                : entry.previous - entry.current);
+                        break;
+                    case SeedOutcome::Rediscovered:
+                        LOG_WARN("  rediscovered {}::{} 0x{:X} -> 0x{:X}", ns, name,
+                                 entry.previous, entry.current);
+                        break;
+                    case SeedOutcome::New:
+                        LOG_INFO("  new          {}::{} 0x{:X}", ns, name, entry.current);
+                        break;
                 }
             }
+            if (!reused.empty())
+                LOG_INFO("  reused       {}: {}", ns, reused);
         }
 
-        file << "}\n";
-        file.close();
-
-        LOG_SUCCESS("Created: {} ({} offsets | {:.2f}s)", filename, total_offsets, duration);
-
-        // Write JSON file
-        std::string json_filename = filename.substr(0, filename.find_last_of('.')) + ".json";
-        std::ofstream json_file(json_filename);
-        if (!json_file.is_open()) {
-            LOG_ERR("Failed to create file: {}", json_filename);
+        if (!missing)
             return;
+        for (const auto& [ns, offsets] : named_seeds()) {
+            for (const auto& [name, value] : offsets) {
+                auto key = find_key(ns, name);
+                if (!found.count(key->packed()))
+                    LOG_WARN("  missing      {}::{} (was 0x{:X})", ns, name, value);
+            }
         }
+    }
 
-        json_file << "{\n";
-        json_file << "    \"metadata\": {\n";
-        json_file << "        \"dumper\": \"Jonah's Roblox Dumper\",\n";
-        json_file << "        \"discord\": \"jonahw\",\n";
-        json_file << "        \"github\": \"https://github.com/nopjo/roblox-dumper\",\n";
-        json_file << "        \"contributors\": [\"@4hd8\", \"@fulore\"],\n";
-        json_file << "        \"timestamp\": \"" << timestamp.str() << "\",\n";
-        if (!roblox_version.empty()) {
-            json_file << "        \"roblox_version\": \"" << roblox_version << "\",\n";
+    // Writes <filename stem>.<format> for each format, see offset_writer::make_sink. False if any
+    // of them was not written.
+    bool write_to_file(const std::string& filename = "offsets.hpp",
+                       const std::vector<std::string>& formats = offset_writer::DEFAULT_FORMATS) {
+        auto end_time = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(end_time - start_time).count();
+
+        offset_file::Dump dump = to_dump();
+        auto& namespace_order = dump.namespace_order;
+
+        auto fflags_it = std::find(namespace_order.begin(), namespace_order.end(), "FFlags");
+        if (fflags_it != namespace_order.end()) {
+            namespace_order.erase(fflags_it);
+            namespace_order.push_back("FFlags");
         }
-        json_file << "        \"total_offsets\": " << std::dec << total_offsets << "\n";
-        json_file << "    },\n";
-        json_file << "    \"offsets\": {\n";
-
-        for (size_t i = 0; i < namespace_order.size(); i++) {
-            const auto& namespace_name = namespace_order[i];
-            auto ns_it = namespaces.find(namespace_name);
-            if (ns_it != namespaces.end()) {
-                json_file << "        \"" << namespace_name << "\": {\n";
-
-                size_t j = 0;
-                for (const auto& [offset_name, offset_value] : ns_it->second) {
-                    json_file << "            \"" << offset_name << "\": " << std::dec
-                              << offset_value;
-
-                    if (j < ns_it->second.size() - 1) {
-                        json_file << ",";
-                    }
-                    json_file << "\n";
-                    j++;
-                }
 
-                json_file << "        }";
+        auto now = std::chrono::system_clock::now();
+        auto time_t_val = std::chrono::system_clock::to_time_t(now);
+        std::stringstream timestamp;
+        timestamp << std::put_time(std::localtime(&time_t_val), "%Y-%m-%d %H:%M:%S");
 
-                if (i < namespace_order.size() - 1) {
-                    json_file << ",";
-                }
-                json_file << "\n";
+        offset_writer::Metadata metadata{timestamp.str(), roblox_version, dump.total_offsets()};
+
+        std::vector<std::unique_ptr<offset_writer::Sink>> sinks;
+        for (const auto& format : formats) {
+            auto sink = offset_writer::make_sink(format);
+            if (!sink) {
+                LOG_ERR("Unknown output format: {}", format);
+                continue;
             }
+            sinks.push_back(std::move(sink));
         }
 
-        json_file << "    }\n";
-        json_file << "}\n";
-        json_file.close();
-
-        LOG_SUCCESS("Created: {}", json_filename);
+        std::string stem = filename.substr(0, filename.find_last_of('.'));
+        size_t written = offset_writer::write(dump, metadata, stem, sinks);
+        LOG_SUCCESS("Wrote {} offsets to {} file(s) ({:.2f}s)", metadata.total_offsets, written,
+                    duration);
+        return written == formats.size();
     }
 };
 
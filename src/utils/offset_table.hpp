@@ -0,0 +1,167 @@
+#pragma once
+// Reader for offsets.bin, the binary twin of offsets.json. Self-contained (standard library only)
+// so consumers can copy it into their own tree.
+//
+// The file is meant to be mapped, not parsed: open() only validates the header and the bounds of
+// each section, and find() hashes the name, reads one displacement and one entry, and compares
+// one string. Nothing is allocated.
+//
+//   Layout (little-endian, every section 8-byte aligned):
+//     Header                      see below
+//     Entry[entry_count]          indexed by the perfect hash
+//     uint32_t[bucket_count]      per-bucket hash seed
+//     char[strings_size]          "Namespace::Name" keys and the Roblox version, not terminated
+//
+// Keys are placed with hash-and-displace: a key's bucket is hash(key) % bucket_count, and its
+// slot is hash(key, seeds[bucket]) % entry_count. The writer picks each bucket's seed so that
+// every key lands in its own slot, which makes the table minimal (no empty slots) and lookups a
+// fixed amount of work. A name that is not in the table still lands on some slot, so find()
+// compares the stored key before answering.
+//
+//   offset_table::Reader table;
+//   if (!table.open(mapped_file, mapped_size))
+//       return false;
+//   std::optional<uint64_t> parent = table.find("Instance", "Parent");
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace offset_table {
+
+    inline constexpr char MAGIC[4] = {'R', 'D', 'O', 'T'};
+    inline constexpr uint16_t VERSION = 1;
+
+    struct Header {
+        char magic[4];
+        uint16_t version;
+        uint16_t reserved;
+        uint32_t entry_count;
+        uint32_t bucket_count;
+        uint32_t entries_offset;
+        uint32_t seeds_offset;
+        uint32_t strings_offset;
+        uint32_t strings_size;
+        uint32_t roblox_version_offset;
+        uint32_t roblox_version_length;
+    };
+    static_assert(sizeof(Header) == 40);
+
+    struct Entry {
+        uint32_t key_offset;
+        uint32_t key_length;
+        uint64_t value;
+    };
+    static_assert(sizeof(Entry) == 16);
+
+    inline constexpr std::string_view KEY_SEPARATOR = "::";
+
+    // FNV-1a over namespace, "::" and name without building the joined string
+    constexpr uint64_t hash_key(std::string_view ns, std::string_view name) {
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (std::string_view part : {ns, KEY_SEPARATOR, name}) {
+            for (char c : part) {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 0x100000001B3ull;
+            }
+        }
+        return hash;
+    }
+
+    // splitmix64 finalizer; seed 0 picks the bucket, the bucket's seed picks the slot
+    constexpr uint64_t mix(uint64_t hash, uint32_t seed) {
+        uint64_t x = hash + 0x9E3779B97F4A7C15ull * (uint64_t(seed) + 1);
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    class Reader {
+      public:
+        // data has to stay mapped for as long as the reader is used
+        bool open(const void* data, size_t size) {
+            // a reader that failed to open behaves like an empty table
+            header = {};
+            if (!data || size < sizeof(Header))
+                return false;
+
+            Header h;
+            std::memcpy(&h, data, sizeof(Header));
+            if (std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0 || h.version != VERSION)
+                return false;
+            if (h.entry_count != 0 && h.bucket_count == 0)
+                return false;
+
+            auto fits = [&](uint64_t offset, uint64_t bytes) { return offset + bytes <= size; };
+            if (!fits(h.entries_offset, uint64_t(h.entry_count) * sizeof(Entry)) ||
+                !fits(h.seeds_offset, uint64_t(h.bucket_count) * sizeof(uint32_t)) ||
+                !fits(h.strings_offset, h.strings_size) ||
+                uint64_t(h.roblox_version_offset) + h.roblox_version_length > h.strings_size)
+                return false;
+
+            bytes = static_cast<const uint8_t*>(data);
+            header = h;
+            return true;
+        }
+
+        size_t size() const { return header.entry_count; }
+
+        std::string_view roblox_version() const {
+            return string_at(header.roblox_version_offset, header.roblox_version_length);
+        }
+
+        std::optional<uint64_t> find(std::string_view ns, std::string_view name) const {
+            if (header.entry_count == 0)
+                return std::nullopt;
+
+            uint64_t hash = hash_key(ns, name);
+            uint32_t seed = load<uint32_t>(header.seeds_offset +
+                                           (mix(hash, 0) % header.bucket_count) * sizeof(uint32_t));
+            Entry entry = load<Entry>(header.entries_offset +
+                                      (mix(hash, seed) % header.entry_count) * sizeof(Entry));
+
+            std::string_view key = string_at(entry.key_offset, entry.key_length);
+            if (key.size() != ns.size() + KEY_SEPARATOR.size() + name.size() ||
+                key.substr(0, ns.size()) != ns ||
+                key.substr(ns.size(), KEY_SEPARATOR.size()) != KEY_SEPARATOR ||
+                key.substr(ns.size() + KEY_SEPARATOR.size()) != name)
+                return std::nullopt;
+            return entry.value;
+        }
+
+        // "Namespace::Name"
+        std::optional<uint64_t> find(std::string_view qualified) const {
+            size_t separator = qualified.find(KEY_SEPARATOR);
+            if (separator == std::string_view::npos)
+                return std::nullopt;
+            return find(qualified.substr(0, separator),
+                        qualified.substr(separator + KEY_SEPARATOR.size()));
+        }
+
+        // slot i, for walking every offset; entries are in hash order
+        std::pair<std::string_view, uint64_t> entry(size_t index) const {
+            Entry e = load<Entry>(header.entries_offset + index * sizeof(Entry));
+            return {string_at(e.key_offset, e.key_length), e.value};
+        }
+
+      private:
+        const uint8_t* bytes = nullptr;
+        Header header{};
+
+        template <typename T> T load(uint64_t offset) const {
+            T value;
+            std::memcpy(&value, bytes + offset, sizeof(T));
+            return value;
+        }
+
+        // out-of-range keys read as empty rather than past the mapping
+        std::string_view string_at(uint32_t offset, uint32_t size) const {
+            if (uint64_t(offset) + size > header.strings_size)
+                return {};
+            return {reinterpret_cast<const char*>(bytes + header.strings_offset + offset), size};
+        }
+    };
+
+} // namespace offset_table
@@ -0,0 +1,260 @@
+#pragma once
+#include "utils/logger.hpp"
+#include "utils/offset_file.hpp"
+#include "utils/offset_table.hpp"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Builds offsets.bin (see utils/offset_table.hpp for the format and the reader), and the same
+// perfect hash as constexpr C++ for offsets.hpp.
+namespace offset_table {
+
+    // keys per hash bucket on average: fewer finds every bucket's seed faster, more makes the
+    // seed array smaller; at 4 a full dump builds in well under a millisecond
+    inline constexpr size_t KEYS_PER_BUCKET = 4;
+    inline constexpr uint32_t MAX_SEED = 1u << 20;
+
+    struct Placement {
+        size_t bucket_count = 0;
+        std::vector<uint32_t> seeds;
+        // slot of each key, in the order the hashes were passed
+        std::vector<size_t> slot_of;
+    };
+
+    // Hash-and-displace over the given key hashes; nullopt only if some bucket finds no seed,
+    // which would take duplicate keys.
+    inline std::optional<Placement> place(const std::vector<uint64_t>& hashes) {
+        const size_t count = hashes.size();
+
+        Placement placement;
+        placement.bucket_count =
+            (std::max)(size_t(1), (count + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET);
+        placement.seeds.assign(placement.bucket_count, 0);
+        placement.slot_of.assign(count, 0);
+
+        std::vector<std::vector<size_t>> buckets(placement.bucket_count);
+        for (size_t i = 0; i < count; i++)
+            buckets[mix(hashes[i], 0) % placement.bucket_count].push_back(i);
+
+        // fullest buckets first, while most slots are still free
+        std::vector<size_t> order(placement.bucket_count);
+        std::iota(order.begin(), order.end(), size_t(0));
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        std::vector<bool> taken(count, false);
+        std::vector<size_t> slots;
+
+        for (size_t bucket : order) {
+            if (buckets[bucket].empty())
+                break;
+
+            bool placed = false;
+            for (uint32_t seed = 1; seed < MAX_SEED && !placed; seed++) {
+                slots.clear();
+                placed = true;
+                for (size_t key : buckets[bucket]) {
+                    size_t slot = mix(hashes[key], seed) % count;
+                    if (taken[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+                        placed = false;
+                        break;
+                    }
+                    slots.push_back(slot);
+                }
+                if (placed) {
+                    placement.seeds[bucket] = seed;
+                    for (size_t i = 0; i < slots.size(); i++) {
+                        taken[slots[i]] = true;
+                        placement.slot_of[buckets[bucket][i]] = slots[i];
+                    }
+                }
+            }
+
+            if (!placed) {
+                LOG_ERR("Failed to build a perfect hash over {} offsets", count);
+                return std::nullopt;
+            }
+        }
+        return placement;
+    }
+
+    inline std::optional<std::string> build(const offset_file::Dump& dump) {
+        struct Key {
+            std::string text;
+            uint64_t value;
+        };
+
+        std::vector<Key> keys;
+        std::vector<uint64_t> hashes;
+        for (const auto& [ns, offsets] : dump.namespaces) {
+            for (const auto& [name, value] : offsets) {
+                keys.push_back({ns + std::string(KEY_SEPARATOR) + name, uint64_t(value)});
+                hashes.push_back(hash_key(ns, name));
+            }
+        }
+
+        auto placement = place(hashes);
+        if (!placement)
+            return std::nullopt;
+
+        const size_t count = keys.size();
+        const size_t bucket_count = placement->bucket_count;
+        const auto& seeds = placement->seeds;
+        const auto& slot_of = placement->slot_of;
+
+        auto align = [](size_t offset) { return (offset + 7) & ~size_t(7); };
+
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.entry_count = static_cast<uint32_t>(count);
+        header.bucket_count = static_cast<uint32_t>(bucket_count);
+        header.entries_offset = static_cast<uint32_t>(align(sizeof(Header)));
+        header.seeds_offset =
+            static_cast<uint32_t>(align(header.entries_offset + count * sizeof(Entry)));
+        header.strings_offset =
+            static_cast<uint32_t>(align(header.seeds_offset + bucket_count * sizeof(uint32_t)));
+
+        std::string strings;
+        std::vector<Entry> entries(count);
+        for (size_t i = 0; i < count; i++) {
+            entries[slot_of[i]] = {static_cast<uint32_t>(strings.size()),
+                                   static_cast<uint32_t>(keys[i].text.size()), keys[i].value};
+            strings += keys[i].text;
+        }
+        header.roblox_version_offset = static_cast<uint32_t>(strings.size());
+        header.roblox_version_length = static_cast<uint32_t>(dump.roblox_version.size());
+        strings += dump.roblox_version;
+        header.strings_size = static_cast<uint32_t>(strings.size());
+
+        std::string out(header.strings_offset + strings.size(), '\0');
+        std::memcpy(out.data(), &header, sizeof(Header));
+        if (count) {
+            std::memcpy(out.data() + header.entries_offset, entries.data(),
+                        count * sizeof(Entry));
+        }
+        std::memcpy(out.data() + header.seeds_offset, seeds.data(),
+                    bucket_count * sizeof(uint32_t));
+        std::memcpy(out.data() + header.strings_offset, strings.data(), strings.size());
+        return out;
+    }
+
+    // The body of offsets::lookup for offsets.hpp, to go inside namespace offsets after the
+    // per-class namespaces it refers to. It carries its own copy of hash_key and mix so the
+    // generated header stays free-standing; it needs <optional> and <string_view>.
+    inline std::optional<std::string> lookup_source(const offset_file::Dump& dump) {
+        std::vector<std::pair<std::string, std::string>> keys;
+        std::vector<uint64_t> hashes;
+        for (const auto& [ns, offsets] : dump.namespaces) {
+            for (const auto& [name, value] : offsets) {
+                keys.push_back({ns, name});
+                hashes.push_back(hash_key(ns, name));
+            }
+        }
+
+        std::ostringstream out;
+        // consteval, so literal keys are guaranteed to become constants and a typo or an offset
+        // this dump does not have fails to compile
+        const char* get_source = R"(
+    consteval uintptr_t get(std::string_view ns, std::string_view name) {
+        auto value = lookup(ns, name);
+        if (!value)
+            throw "offset is not in this dump";
+        return *value;
+    }
+)";
+
+        out << R"(    // Offsets by name: lookup("Humanoid", "WalkSpeed") is one perfect-hash probe
+    // and one compare at runtime, get(...) the same resolved at compile time.
+)";
+
+        if (keys.empty()) {
+            out << R"(
+    constexpr std::optional<uintptr_t> lookup(std::string_view, std::string_view) {
+        return std::nullopt;
+    }
+)" << get_source;
+            return out.str();
+        }
+
+        auto placement = place(hashes);
+        if (!placement)
+            return std::nullopt;
+
+        std::vector<size_t> by_slot(keys.size());
+        for (size_t i = 0; i < keys.size(); i++)
+            by_slot[placement->slot_of[i]] = i;
+
+        out << R"(    namespace lookup_table {
+        struct Entry {
+            std::string_view ns;
+            std::string_view name;
+            uintptr_t value;
+        };
+
+        constexpr uint64_t hash_key(std::string_view ns, std::string_view name) {
+            uint64_t hash = 0xCBF29CE484222325ull;
+            for (std::string_view part : {ns, std::string_view("::"), name}) {
+                for (char c : part) {
+                    hash ^= static_cast<uint8_t>(c);
+                    hash *= 0x100000001B3ull;
+                }
+            }
+            return hash;
+        }
+
+        constexpr uint64_t mix(uint64_t hash, uint32_t seed) {
+            uint64_t x = hash + 0x9E3779B97F4A7C15ull * (uint64_t(seed) + 1);
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+            return x ^ (x >> 31);
+        }
+
+)";
+        out << "        inline constexpr uint32_t seeds[" << placement->bucket_count << "] = {";
+        for (size_t i = 0; i < placement->seeds.size(); i++) {
+            out << (i % 12 == 0 ? "\n            " : " ") << placement->seeds[i] << ",";
+        }
+        out << "\n        };\n\n";
+
+        out << "        inline constexpr Entry entries[" << keys.size() << "] = {\n";
+        for (size_t slot = 0; slot < keys.size(); slot++) {
+            const auto& [ns, name] = keys[by_slot[slot]];
+            out << "            {\"" << ns << "\", \"" << name << "\", " << ns << "::" << name
+                << "},\n";
+        }
+        out << "        };\n"
+               "    } // namespace lookup_table\n";
+
+        out << R"(
+    constexpr std::optional<uintptr_t> lookup(std::string_view ns, std::string_view name) {
+        using namespace lookup_table;
+        uint64_t hash = hash_key(ns, name);
+        uint32_t seed = seeds[mix(hash, 0) % std::size(seeds)];
+        const Entry& entry = entries[mix(hash, seed) % std::size(entries)];
+        if (entry.ns != ns || entry.name != name)
+            return std::nullopt;
+        return entry.value;
+    }
+)" << get_source << R"(
+    namespace lookup_table {
+        constexpr bool self_test() {
+            for (const Entry& entry : entries) {
+                if (lookup(entry.ns, entry.name) != entry.value)
+                    return false;
+            }
+            return !lookup("", "").has_value();
+        }
+        static_assert(self_test(), "offsets::lookup does not resolve every offset");
+    } // namespace lookup_table
+)";
+        return out.str();
+    }
+
+} // namespace offset_table
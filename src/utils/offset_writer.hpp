@@ -0,0 +1,281 @@
+#pragma once
+#include "utils/logger.hpp"
+#include "utils/offset_file.hpp"
+#include "utils/offset_table_writer.hpp"
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Output formats for a finished dump. write() walks the dump once, in output order, and hands each
+// offset to every requested Sink. A sink formats into its own buffer, reserved up front from the
+// offset count, and the buffer goes to disk in a single atomic write at the end. A new format is
+// one Sink subclass plus a line in make_sink.
+namespace offset_writer {
+
+    struct Metadata {
+        std::string timestamp;
+        std::string roblox_version;
+        size_t total_offsets = 0;
+    };
+
+    class Sink {
+      public:
+        virtual ~Sink() = default;
+
+        // appended to the output stem, e.g. ".hpp"
+        virtual std::string_view extension() const = 0;
+        // rough size of one formatted offset, for reserving the buffer
+        virtual size_t bytes_per_offset() const { return 64; }
+
+        virtual void begin(const Metadata& /*metadata*/) {}
+        virtual void begin_namespace(std::string_view /*ns*/, bool /*first*/) {}
+        virtual void offset(std::string_view /*ns*/, std::string_view /*name*/,
+                            uintptr_t /*value*/) {}
+        virtual void end_namespace(std::string_view /*ns*/, bool /*last*/) {}
+        // formats that need the whole dump at once (hash tables) build here; false drops the file
+        virtual bool end(const offset_file::Dump& /*dump*/) { return true; }
+
+        std::string buffer;
+
+      protected:
+        template <typename... Args>
+        void append(std::format_string<Args...> format, Args&&... args) {
+            std::format_to(std::back_inserter(buffer), format, std::forward<Args>(args)...);
+        }
+
+        // the banner every text format starts with, behind its own comment marker
+        void banner(std::string_view comment, const Metadata& metadata) {
+            append("{0}================================================================\n"
+                   "{0} Dumped By Jonah's Roblox Dumper | Discord: jonahw\n"
+                   "{0} Github Link: https://github.com/nopjo/roblox-dumper\n"
+                   "{0} Contributors: @4hd8, @fulore \n"
+                   "{0} Dumped at: {1}\n",
+                   comment, metadata.timestamp);
+            if (!metadata.roblox_version.empty())
+                append("{} Roblox Version: {}\n", comment, metadata.roblox_version);
+            append("{0} Total offsets dumped: {1}\n"
+                   "{0}================================================================\n\n",
+                   comment, metadata.total_offsets);
+        }
+    };
+
+    class HeaderSink : public Sink {
+      public:
+        std::string_view extension() const override { return ".hpp"; }
+        size_t bytes_per_offset() const override { return 160; }
+
+        void begin(const Metadata& metadata) override {
+            banner("//", metadata);
+            append("#pragma once\n"
+                   "#include <cstdint>\n"
+                   "#include <iterator>\n"
+                   "#include <optional>\n"
+                   "#include <string_view>\n\n"
+                   "namespace offsets {{\n");
+        }
+        void begin_namespace(std::string_view ns, bool first) override {
+            append("{}    namespace {} {{\n", first ? "" : "\n", ns);
+        }
+        void offset(std::string_view /*ns*/, std::string_view name, uintptr_t value) override {
+            append("        inline constexpr uintptr_t {} = 0x{:X};\n", name, value);
+        }
+        void end_namespace(std::string_view /*ns*/, bool /*last*/) override { append("    }}\n"); }
+        bool end(const offset_file::Dump& dump) override {
+            if (auto lookup = offset_table::lookup_source(dump))
+                append("\n{}", *lookup);
+            append("}}\n");
+            return true;
+        }
+    };
+
+    class JsonSink : public Sink {
+      public:
+        std::string_view extension() const override { return ".json"; }
+
+        void begin(const Metadata& metadata) override {
+            append("{{\n"
+                   "    \"metadata\": {{\n"
+                   "        \"dumper\": \"Jonah's Roblox Dumper\",\n"
+                   "        \"discord\": \"jonahw\",\n"
+                   "        \"github\": \"https://github.com/nopjo/roblox-dumper\",\n"
+                   "        \"contributors\": [\"@4hd8\", \"@fulore\"],\n"
+                   "        \"timestamp\": \"{}\",\n",
+                   metadata.timestamp);
+            if (!metadata.roblox_version.empty())
+                append("        \"roblox_version\": \"{}\",\n", metadata.roblox_version);
+            append("        \"total_offsets\": {}\n"
+                   "    }},\n"
+                   "    \"offsets\": {{\n",
+                   metadata.total_offsets);
+        }
+        void begin_namespace(std::string_view ns, bool /*first*/) override {
+            append("        \"{}\": {{", ns);
+            first_offset = true;
+        }
+        void offset(std::string_view /*ns*/, std::string_view name, uintptr_t value) override {
+            append("{}\n            \"{}\": {}", first_offset ? "" : ",", name, value);
+            first_offset = false;
+        }
+        void end_namespace(std::string_view /*ns*/, bool last) override {
+            append("\n        }}{}\n", last ? "" : ",");
+        }
+        bool end(const offset_file::Dump& /*dump*/) override {
+            append("    }}\n}}\n");
+            return true;
+        }
+
+      private:
+        bool first_offset = true;
+    };
+
+    // offsets.bin, see utils/offset_table.hpp
+    class TableSink : public Sink {
+      public:
+        std::string_view extension() const override { return ".bin"; }
+        size_t bytes_per_offset() const override { return 0; }
+
+        bool end(const offset_file::Dump& dump) override {
+            auto table = offset_table::build(dump);
+            if (!table)
+                return false;
+            buffer = std::move(*table);
+            return true;
+        }
+    };
+
+    class CsvSink : public Sink {
+      public:
+        std::string_view extension() const override { return ".csv"; }
+        size_t bytes_per_offset() const override { return 48; }
+
+        void begin(const Metadata& /*metadata*/) override { append("namespace,name,offset\n"); }
+        void offset(std::string_view ns, std::string_view name, uintptr_t value) override {
+            append("{},{},0x{:X}\n", ns, name, value);
+        }
+    };
+
+    class RustSink : public Sink {
+      public:
+        std::string_view extension() const override { return ".rs"; }
+        size_t bytes_per_offset() const override { return 56; }
+
+        void begin(const Metadata& metadata) override {
+            banner("//", metadata);
+            append("#![allow(non_snake_case, non_upper_case_globals, dead_code)]\n\n");
+        }
+        void begin_namespace(std::string_view ns, bool first) override {
+            append("{}pub mod {} {{\n", first ? "" : "\n", ns);
+        }
+        void offset(std::string_view /*ns*/, std::string_view name, uintptr_t value) override {
+            append("    pub const {}: usize = 0x{:X};\n", name, value);
+        }
+        void end_namespace(std::string_view /*ns*/, bool /*last*/) override { append("}}\n"); }
+    };
+
+    class CSharpSink : public Sink {
+      public:
+        std::string_view extension() const override { return ".cs"; }
+        size_t bytes_per_offset() const override { return 64; }
+
+        void begin(const Metadata& metadata) override {
+            banner("//", metadata);
+            append("namespace Offsets\n{{\n");
+        }
+        void begin_namespace(std::string_view ns, bool first) override {
+            append("{}    public static class {}\n    {{\n", first ? "" : "\n", ns);
+        }
+        void offset(std::string_view ns, std::string_view name, uintptr_t value) override {
+            // C# does not allow a member named like its class (Value.Value)
+            append("        public const ulong {}{} = 0x{:X};\n", name, name == ns ? "_" : "",
+                   value);
+        }
+        void end_namespace(std::string_view /*ns*/, bool /*last*/) override { append("    }}\n"); }
+        bool end(const offset_file::Dump& /*dump*/) override {
+            append("}}\n");
+            return true;
+        }
+    };
+
+    class PythonSink : public Sink {
+      public:
+        std::string_view extension() const override { return ".py"; }
+        size_t bytes_per_offset() const override { return 40; }
+
+        void begin(const Metadata& metadata) override { banner("#", metadata); }
+        void begin_namespace(std::string_view ns, bool first) override {
+            append("{}class {}:\n", first ? "" : "\n\n", ns);
+        }
+        void offset(std::string_view /*ns*/, std::string_view name, uintptr_t value) override {
+            append("    {} = 0x{:X}\n", name, value);
+        }
+    };
+
+    inline const std::vector<std::string> DEFAULT_FORMATS = {"hpp", "json", "bin"};
+
+    // nullptr for an unknown format
+    inline std::unique_ptr<Sink> make_sink(std::string_view format) {
+        if (format == "hpp")
+            return std::make_unique<HeaderSink>();
+        if (format == "json")
+            return std::make_unique<JsonSink>();
+        if (format == "bin")
+            return std::make_unique<TableSink>();
+        if (format == "csv")
+            return std::make_unique<CsvSink>();
+        if (format == "rs")
+            return std::make_unique<RustSink>();
+        if (format == "cs")
+            return std::make_unique<CSharpSink>();
+        if (format == "py")
+            return std::make_unique<PythonSink>();
+        return nullptr;
+    }
+
+    // Writes <stem><extension> for every sink and returns how many files were written.
+    // dump.namespace_order is the output order.
+    inline size_t write(const offset_file::Dump& dump, const Metadata& metadata,
+                        const std::string& stem, const std::vector<std::unique_ptr<Sink>>& sinks) {
+        for (const auto& sink : sinks) {
+            sink->buffer.clear();
+            sink->buffer.reserve(1024 + metadata.total_offsets * sink->bytes_per_offset());
+            sink->begin(metadata);
+        }
+
+        std::vector<std::string_view> order;
+        for (const auto& ns : dump.namespace_order) {
+            if (dump.namespaces.count(ns))
+                order.push_back(ns);
+        }
+
+        for (size_t i = 0; i < order.size(); i++) {
+            const auto& offsets = dump.namespaces.find(std::string(order[i]))->second;
+            for (const auto& sink : sinks)
+                sink->begin_namespace(order[i], i == 0);
+            for (const auto& [name, value] : offsets) {
+                for (const auto& sink : sinks)
+                    sink->offset(order[i], name, value);
+            }
+            for (const auto& sink : sinks)
+                sink->end_namespace(order[i], i + 1 == order.size());
+        }
+
+        size_t written = 0;
+        for (const auto& sink : sinks) {
+            std::string path = stem + std::string(sink->extension());
+            if (!sink->end(dump)) {
+                LOG_ERR("Failed to format {}", path);
+                continue;
+            }
+            if (offset_file::write_atomic(path, sink->buffer)) {
+                LOG_SUCCESS("Created: {}", path);
+                written++;
+            }
+        }
+        return written;
+    }
+
+} // namespace offset_writer
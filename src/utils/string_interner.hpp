@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Maps strings to dense uint32_t ids, so hot paths can compare and hash integers instead of
+// strings. Ids are never reused and names never move, so both stay valid for the interner's
+// lifetime. Lookups of strings that are already interned only take a shared lock.
+class StringInterner {
+  public:
+    using Id = uint32_t;
+
+    Id intern(std::string_view name) {
+        if (auto id = find(name))
+            return *id;
+
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        auto it = ids.find(name);
+        if (it != ids.end())
+            return it->second;
+
+        Id id = static_cast<Id>(names.size());
+        const std::string& stored = names.emplace_back(name);
+        ids.emplace(std::string_view(stored), id);
+        return id;
+    }
+
+    // nullopt if name was never interned; never adds it
+    std::optional<Id> find(std::string_view name) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = ids.find(name);
+        if (it == ids.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    const std::string& name(Id id) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return names[id];
+    }
+
+  private:
+    mutable std::shared_mutex mutex;
+    // keys view into names, whose elements a deque never relocates
+    std::unordered_map<std::string_view, Id> ids;
+    std::deque<std::string> names;
+};
@@ -0,0 +1,176 @@
+// Converts the events.bin a dump writes (see src/utils/event_log.hpp) to JSON or CSV, so a run
+// can be looked at afterwards on any machine.
+//
+//   roblox-dumper-events <events.bin> [--csv] [--output <path>]
+//
+// JSON is {"session_start_ns": ..., "events": [{"time_ns", "thread", "type", <fields>...}]}.
+// CSV has one column per distinct field name across all event types, empty where an event does
+// not have that field. Output goes to stdout unless --output is given.
+
+#include "utils/event_log.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+
+    nlohmann::ordered_json to_json(const event_log::Value& value) {
+        switch (value.type) {
+            case event_log::FieldType::U64:
+                return value.u64;
+            case event_log::FieldType::F64:
+                return value.f64;
+            case event_log::FieldType::Bool:
+                return value.flag;
+            case event_log::FieldType::OptionalU64:
+                return value.flag ? nlohmann::ordered_json(value.u64) : nullptr;
+            case event_log::FieldType::String:
+                return std::string(value.text);
+        }
+        return nullptr;
+    }
+
+    std::string csv_cell(const event_log::Value& value) {
+        switch (value.type) {
+            case event_log::FieldType::U64:
+                return std::to_string(value.u64);
+            case event_log::FieldType::F64:
+                return std::to_string(value.f64);
+            case event_log::FieldType::Bool:
+                return value.flag ? "true" : "false";
+            case event_log::FieldType::OptionalU64:
+                return value.flag ? std::to_string(value.u64) : "";
+            case event_log::FieldType::String:
+                break;
+        }
+
+        std::string text(value.text);
+        if (text.find_first_of(",\"\n") == std::string::npos)
+            return text;
+        std::string quoted = "\"";
+        for (char c : text) {
+            if (c == '"')
+                quoted += '"';
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+
+    void write_json(event_log::Reader& reader, std::ostream& out) {
+        nlohmann::ordered_json events = nlohmann::ordered_json::array();
+        while (auto event = reader.next()) {
+            nlohmann::ordered_json entry = {
+                {"time_ns", event->time_ns},
+                {"thread", event->thread},
+                {"type", event->schema ? nlohmann::ordered_json(event->schema->name)
+                                       : nlohmann::ordered_json(event->type)},
+            };
+            for (size_t i = 0; i < event->values.size(); i++)
+                entry[std::string(event->schema->fields[i].name)] = to_json(event->values[i]);
+            events.push_back(std::move(entry));
+        }
+
+        nlohmann::ordered_json document = {
+            {"session_start_ns", reader.session_start_ns},
+            {"events", std::move(events)},
+        };
+        out << document.dump(2) << "\n";
+    }
+
+    void write_csv(event_log::Reader& reader, std::ostream& out) {
+        std::vector<std::string_view> columns;
+        for (const auto& schema : event_log::SCHEMAS) {
+            for (const auto& field : schema.fields) {
+                if (std::find(columns.begin(), columns.end(), field.name) == columns.end())
+                    columns.push_back(field.name);
+            }
+        }
+
+        out << "time_ns,thread,type";
+        for (auto column : columns)
+            out << "," << column;
+        out << "\n";
+
+        std::vector<std::string> row(columns.size());
+        while (auto event = reader.next()) {
+            std::fill(row.begin(), row.end(), std::string());
+            for (size_t i = 0; i < event->values.size(); i++) {
+                auto column = std::find(columns.begin(), columns.end(),
+                                        event->schema->fields[i].name);
+                row[column - columns.begin()] = csv_cell(event->values[i]);
+            }
+
+            out << event->time_ns << "," << event->thread << ",";
+            if (event->schema)
+                out << event->schema->name;
+            else
+                out << event->type;
+            for (const auto& cell : row)
+                out << "," << cell;
+            out << "\n";
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string input;
+    std::string output;
+    bool csv = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--csv")) {
+            csv = true;
+        } else if (!std::strcmp(argv[i], "--output") && i + 1 < argc) {
+            output = argv[++i];
+        } else if (input.empty() && argv[i][0] != '-') {
+            input = argv[i];
+        } else {
+            input.clear();
+            break;
+        }
+    }
+    if (input.empty()) {
+        std::fprintf(stderr, "usage: %s <events.bin> [--csv] [--output <path>]\n", argv[0]);
+        return 1;
+    }
+
+    std::ifstream file(input, std::ios::binary);
+    if (!file.is_open()) {
+        std::fprintf(stderr, "failed to open %s\n", input.c_str());
+        return 1;
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    event_log::Reader reader;
+    if (!reader.open(data.data(), data.size())) {
+        std::fprintf(stderr, "%s is not an event log this build can read\n", input.c_str());
+        return 1;
+    }
+
+    std::ofstream output_file;
+    if (!output.empty()) {
+        output_file.open(output, std::ios::trunc);
+        if (!output_file.is_open()) {
+            std::fprintf(stderr, "failed to create %s\n", output.c_str());
+            return 1;
+        }
+    }
+    std::ostream& out = output.empty() ? std::cout : output_file;
+
+    if (csv)
+        write_csv(reader, out);
+    else
+        write_json(reader, out);
+
+    // the run that wrote the log probably died; everything before the damage was still decoded
+    if (reader.truncated)
+        std::fprintf(stderr, "warning: %s ends in a truncated record\n", input.c_str());
+    return 0;
+}